@@ -0,0 +1,438 @@
+#include "DBAndersen.h"
+#include "Util/Options.h"
+
+using namespace SVF;
+
+void DBAndersenWaveDiff::analyze()
+{
+    if (analyzeFromDB())
+    {
+        return;
+    }
+    AndersenWaveDiff::analyze();
+    storeResult();
+}
+
+bool DBAndersenWaveDiff::analyzeFromDB()
+{
+    if (!ReadPTAFromDB() && !PTAWarmStart())
+    {
+        return false;
+    }
+    GraphDBClient& client = GraphDBClient::getInstance();
+    DBPTAResult result;
+    if (!client.readPTAFromDB(client.getConnection(), "PTA", result))
+    {
+        SVFUtil::outs() << "Warning: [DBAndersenWaveDiff] no PTA graph in DB, solving\n";
+        return false;
+    }
+    if (ReadPTAFromDB() && result.pagStamp == client.readVersionStamp(client.getConnection(), "PAG"))
+    {
+        initialize();
+        loadResult(result);
+        finalize();
+        storeIndCallEdges();
+        return true;
+    }
+    if (PTAWarmStart())
+    {
+        return warmStart(result);
+    }
+    SVFUtil::outs() << "Warning: [DBAndersenWaveDiff] the PTA graph was computed on another PAG, solving\n";
+    return false;
+}
+
+void DBAndersenWaveDiff::mapStoredIds(const DBPTAResult& result, const DBPAGNodeKeys& keys,
+                                      const Set<std::string>& changedFuns, Map<NodeID, NodeID>& storedId2Id)
+{
+    for (const auto& item : result.funNodes)
+    {
+        auto nodes = keys.funNodes.find(item.first);
+        bool isMapped = nodes != keys.funNodes.end() && changedFuns.find(item.first) == changedFuns.end();
+        for (size_t i = 0; i < item.second.size(); ++i)
+        {
+            storedId2Id[item.second[i]] = isMapped && i < nodes->second.size() ? nodes->second[i] : unmappedId;
+        }
+    }
+    for (const auto& item : result.globalNodes)
+    {
+        auto node = keys.globalNodes.find(item.second);
+        storedId2Id[item.first] = node != keys.globalNodes.end() ? node->second : unmappedId;
+    }
+}
+
+void DBAndersenWaveDiff::createGepObjs(const DBPTAResult& result, const Set<NodeID>& changedNodes,
+                                       Map<NodeID, NodeID>& storedId2Id)
+{
+    // the field objects of this run may get other ids than those of the run stored
+    for (const auto& gepObj : result.gepObjs)
+    {
+        NodeID baseId;
+        if (!getCurrentId(storedId2Id, std::get<1>(gepObj), baseId) ||
+            !SVFUtil::isa<BaseObjVar>(pag->getGNode(baseId)) || changedNodes.find(baseId) != changedNodes.end())
+            storedId2Id[std::get<0>(gepObj)] = unmappedId;
+        else
+            storedId2Id[std::get<0>(gepObj)] = consCG->getGepObjVar(baseId, std::get<2>(gepObj));
+    }
+}
+
+bool DBAndersenWaveDiff::getCurrentId(const Map<NodeID, NodeID>& storedId2Id, NodeID storedId, NodeID& id) const
+{
+    auto it = storedId2Id.find(storedId);
+    if (it == storedId2Id.end())
+        return false;
+    id = it->second;
+    return id != unmappedId;
+}
+
+void DBAndersenWaveDiff::loadResult(const DBPTAResult& result)
+{
+    // the PAG the sets were computed on: its nodes have their ids, but the
+    // field objects, which are created again
+    Map<NodeID, NodeID> storedId2Id;
+    for (auto it = pag->begin(); it != pag->end(); ++it)
+    {
+        if (!SVFUtil::isa<GepObjVar>(it->second))
+            storedId2Id[it->first] = it->first;
+    }
+    for (NodeID id : result.fieldInsensitiveObjs)
+    {
+        if (pag->hasGNode(id) && SVFUtil::isa<BaseObjVar>(pag->getGNode(id)))
+            consCG->setObjFieldInsensitive(id);
+    }
+    createGepObjs(result, Set<NodeID>(), storedId2Id);
+    for (const auto& item : result.pts)
+    {
+        NodeID ptr;
+        if (!getCurrentId(storedId2Id, item.first, ptr))
+            continue;
+        for (NodeID storedObj : item.second)
+        {
+            NodeID obj;
+            if (getCurrentId(storedId2Id, storedObj, obj))
+                addPts(ptr, obj);
+        }
+    }
+    // the indirect call edges found by the stored run
+    updateCallGraph(getIndirectCallsites());
+}
+
+bool DBAndersenWaveDiff::warmStart(const DBPTAResult& result)
+{
+    GraphDBClient& client = GraphDBClient::getInstance();
+    if (result.globalNodes.empty())
+    {
+        SVFUtil::outs() << "Warning: [DBAndersenWaveDiff] the PTA graph has no node keys (written by an older build?), solving\n";
+        return false;
+    }
+    DBPAGNodeKeys keys;
+    client.getPAGNodeKeys(pag, keys);
+    DBWritePlan hashes;
+    client.hashPAGContent(pag, keys, hashes);
+    // the stmts outside the functions, e.g. the initializers of the globals, reach every function
+    if (result.globalHash.empty() || result.globalHash != hashes.getGraphHash("PAG"))
+    {
+        SVFUtil::outs() << "Warning: [DBAndersenWaveDiff] the PAG rows outside the functions changed, solving\n";
+        return false;
+    }
+
+    // the functions changed, added or removed; the nodes of the others keep
+    // their keys, by which the stored ids are mapped to those of this run
+    Set<std::string> changedFuns;
+    Map<std::string, std::string> storedHashes(result.funHashes.begin(), result.funHashes.end());
+    for (const auto& item : hashes.getFunctionHashes())
+    {
+        auto stored = storedHashes.find(item.first);
+        if (stored == storedHashes.end() || stored->second != DBWritePlan::toString(item.second))
+            changedFuns.insert(item.first);
+    }
+    for (const auto& item : result.funHashes)
+    {
+        if (hashes.getFunctionHashes().find(item.first) == hashes.getFunctionHashes().end())
+            changedFuns.insert(item.first);
+    }
+    Map<NodeID, NodeID> storedId2Id;
+    mapStoredIds(result, keys, changedFuns, storedId2Id);
+
+    // the nodes of the changed functions and of their stmts, as they are now
+    Set<NodeID> changedNodes;
+    for (const std::string& fun : changedFuns)
+    {
+        auto nodes = keys.funNodes.find(fun);
+        if (nodes != keys.funNodes.end())
+            changedNodes.insert(nodes->second.begin(), nodes->second.end());
+    }
+    for (auto it = pag->begin(); it != pag->end(); ++it)
+    {
+        for (auto edgeIter = it->second->OutEdgeBegin(); edgeIter != it->second->OutEdgeEnd(); ++edgeIter)
+        {
+            const SVFStmt* stmt = *edgeIter;
+            const FunObjVar* fun = nullptr != stmt->getICFGNode() ? stmt->getICFGNode()->getFun() : nullptr;
+            if (nullptr != fun && changedFuns.find(fun->getName()) != changedFuns.end())
+            {
+                changedNodes.insert(stmt->getSrcID());
+                changedNodes.insert(stmt->getDstID());
+            }
+        }
+    }
+    // the stmts the changed and removed functions had in the stored run, some of
+    // which are gone: their effects are undone where they landed, i.e. at the
+    // ends of the stmts, in the objects stored into and in the parameters of
+    // the functions called indirectly
+    std::vector<NodeID> storedStoreDsts;
+    std::vector<NodeID> storedIndCallPtrs;
+    for (const auto& item : result.funHashes)
+    {
+        if (changedFuns.find(item.first) == changedFuns.end())
+            continue;
+        auto stmts = result.funStmts.find(item.first);
+        if (stmts == result.funStmts.end())
+        {
+            if (item.second == DBWritePlan::toString(0))
+                continue;
+            SVFUtil::outs() << "Warning: [DBAndersenWaveDiff] the PTA graph has no stmts of the changed function "
+                            << item.first << " (written by an older build?), solving\n";
+            return false;
+        }
+        const std::vector<s64_t>& ids = stmts->second;
+        for (size_t i = 0; i + 2 < ids.size(); i += 3)
+        {
+            NodeID id;
+            if (getCurrentId(storedId2Id, ids[i + 1], id))
+                changedNodes.insert(id);
+            if (getCurrentId(storedId2Id, ids[i + 2], id))
+                changedNodes.insert(id);
+            if (ids[i] == SVFStmt::Store)
+                storedStoreDsts.push_back(ids[i + 2]);
+            else if (ids[i] < 0)
+                storedIndCallPtrs.push_back(ids[i + 1]);
+        }
+    }
+
+    initialize();
+    for (NodeID storedId : result.fieldInsensitiveObjs)
+    {
+        NodeID id;
+        if (getCurrentId(storedId2Id, storedId, id) && SVFUtil::isa<BaseObjVar>(pag->getGNode(id)) &&
+            changedNodes.find(id) == changedNodes.end())
+            consCG->setObjFieldInsensitive(id);
+    }
+    createGepObjs(result, changedNodes, storedId2Id);
+    auto isKept = [this, &changedNodes](NodeID id)
+    {
+        return pag->hasGNode(id) && changedNodes.find(id) == changedNodes.end();
+    };
+    // the stored points-to sets in the ids of this run, without the nodes which are gone
+    Map<NodeID, std::vector<NodeID>> storedPts;
+    for (const auto& item : result.pts)
+    {
+        NodeID ptr;
+        if (!getCurrentId(storedId2Id, item.first, ptr))
+            continue;
+        std::vector<NodeID>& objs = storedPts[ptr];
+        for (NodeID storedObj : item.second)
+        {
+            NodeID obj;
+            if (getCurrentId(storedId2Id, storedObj, obj) && isKept(obj))
+                objs.push_back(obj);
+        }
+    }
+    auto getStoredPts = [&storedPts](NodeID id) -> const std::vector<NodeID>&
+    {
+        static const std::vector<NodeID> empty;
+        auto it = storedPts.find(id);
+        return it != storedPts.end() ? it->second : empty;
+    };
+
+    // the flows of the stored run not in the stmts: the loads of every object
+    // and the parameters of the indirect calls it resolved
+    Map<NodeID, std::vector<NodeID>> obj2LoadDsts;
+    for (const SVFStmt* stmt : pag->getSVFStmtSet(SVFStmt::Load))
+    {
+        for (NodeID obj : getStoredPts(stmt->getSrcID()))
+        {
+            obj2LoadDsts[obj].push_back(stmt->getDstID());
+        }
+    }
+    Map<NodeID, std::vector<NodeID>> callSuccs;
+    for (const auto& item : pag->getIndirectCallsites())
+    {
+        const CallICFGNode* cs = item.first;
+        NodeID funPtr = item.second;
+        for (NodeID obj : getStoredPts(funPtr))
+        {
+            const FunObjVar* callee = SVFUtil::dyn_cast<FunObjVar>(pag->getGNode(obj));
+            if (nullptr == callee)
+                continue;
+            if (pag->hasFunArgsList(callee))
+            {
+                const auto& formals = pag->getFunArgsList(callee);
+                const auto& actuals = cs->getActualParms();
+                for (size_t i = 0; i < formals.size(); ++i)
+                {
+                    if (i < actuals.size())
+                        callSuccs[actuals[i]->getId()].push_back(formals[i]->getId());
+                    callSuccs[funPtr].push_back(formals[i]->getId());
+                }
+            }
+            if (pag->funHasRet(callee) && pag->callsiteHasRet(cs->getRetICFGNode()))
+            {
+                NodeID ret = pag->getCallSiteRet(cs->getRetICFGNode())->getId();
+                callSuccs[pag->getFunRet(callee)->getId()].push_back(ret);
+                callSuccs[funPtr].push_back(ret);
+            }
+        }
+    }
+
+    // what the changed functions may have contributed to: forward along the
+    // stmts, into the objects stored through and out of the objects loaded
+    Set<NodeID> tainted(changedNodes);
+    std::vector<NodeID> worklist(changedNodes.begin(), changedNodes.end());
+    auto taint = [&tainted, &worklist](NodeID id)
+    {
+        if (tainted.insert(id).second)
+            worklist.push_back(id);
+    };
+    // the objects of the stored points-to set of storedPtr, which may be gone from this run
+    Map<NodeID, const std::vector<NodeID>*> storedPtsById;
+    for (const auto& item : result.pts)
+    {
+        storedPtsById[item.first] = &item.second;
+    }
+    auto forEachStoredObj = [this, &storedPtsById, &storedId2Id](NodeID storedPtr, const auto& visit)
+    {
+        auto it = storedPtsById.find(storedPtr);
+        if (it == storedPtsById.end())
+            return;
+        for (NodeID storedObj : *it->second)
+        {
+            NodeID obj;
+            if (getCurrentId(storedId2Id, storedObj, obj))
+                visit(obj);
+        }
+    };
+    for (NodeID storedDst : storedStoreDsts)
+    {
+        forEachStoredObj(storedDst, taint);
+    }
+    for (NodeID storedFunPtr : storedIndCallPtrs)
+    {
+        forEachStoredObj(storedFunPtr, [this, &taint](NodeID obj)
+        {
+            const FunObjVar* callee = SVFUtil::dyn_cast<FunObjVar>(pag->getGNode(obj));
+            if (nullptr == callee || !pag->hasFunArgsList(callee))
+                return;
+            for (const SVFVar* formal : pag->getFunArgsList(callee))
+                taint(formal->getId());
+        });
+    }
+    while (!worklist.empty())
+    {
+        NodeID id = worklist.back();
+        worklist.pop_back();
+        // the ends of the stmts of the stored run may be gone
+        if (!pag->hasGNode(id))
+            continue;
+        const SVFVar* node = pag->getGNode(id);
+        for (auto edgeIter = node->OutEdgeBegin(); edgeIter != node->OutEdgeEnd(); ++edgeIter)
+        {
+            const SVFStmt* stmt = *edgeIter;
+            if (SVFUtil::isa<StoreStmt>(stmt))
+            {
+                for (NodeID obj : getStoredPts(stmt->getDstID()))
+                    taint(obj);
+            }
+            // an object changed only in content is still the address it was
+            else if (!SVFUtil::isa<AddrStmt>(stmt) || changedNodes.find(id) != changedNodes.end())
+            {
+                taint(stmt->getDstID());
+            }
+        }
+        for (auto edgeIter = node->InEdgeBegin(); edgeIter != node->InEdgeEnd(); ++edgeIter)
+        {
+            if (SVFUtil::isa<StoreStmt>(*edgeIter))
+            {
+                for (NodeID obj : getStoredPts(id))
+                    taint(obj);
+            }
+        }
+        auto loads = obj2LoadDsts.find(id);
+        if (loads != obj2LoadDsts.end())
+        {
+            for (NodeID dst : loads->second)
+                taint(dst);
+        }
+        auto succs = callSuccs.find(id);
+        if (succs != callSuccs.end())
+        {
+            for (NodeID dst : succs->second)
+                taint(dst);
+        }
+    }
+
+    u32_t numOfSeeded = 0;
+    for (const auto& item : storedPts)
+    {
+        if (!isKept(item.first) || tainted.find(item.first) != tainted.end())
+            continue;
+        for (NodeID obj : item.second)
+        {
+            addPts(item.first, obj);
+        }
+        ++numOfSeeded;
+    }
+    SVFUtil::outs() << "Warm start: " << changedFuns.size() << " of " << hashes.getFunctionHashes().size()
+                    << " functions changed, " << numOfSeeded << " of " << result.pts.size()
+                    << " points-to sets seeded\n";
+
+    solveConstraints();
+    finalize();
+    storeResult();
+    return true;
+}
+
+void DBAndersenWaveDiff::storeResult()
+{
+    GraphDBClient& client = GraphDBClient::getInstance();
+    if (Write2DB() || client.isOfflineMode())
+    {
+        client.insertPTA2db(this, getPAG());
+    }
+    storeIndCallEdges();
+}
+
+void DBAndersenWaveDiff::storeIndCallEdges()
+{
+    if (Write2DBIndCalls())
+    {
+        GraphDBClient::getInstance().updateIndCallEdges2db(getCallGraph());
+    }
+}
+
+void DBAndersenWaveDiff::shareResult(SVFIR* pag)
+{
+    DBAndersenWaveDiff ander(pag);
+    // the analyses read the user's file, the sets stored are those read from it
+    if (!Options::ReadAnder().empty())
+    {
+        ander.AndersenWaveDiff::analyze();
+        ander.storeResult();
+        return;
+    }
+    if (!ander.analyzeFromDB())
+    {
+        // solved here rather than by the analyses, to be stored for the next run
+        ander.initialize();
+        ander.solveConstraints();
+        ander.finalize();
+        ander.storeResult();
+    }
+    std::string file = createTempFile("svf-ander");
+    if (file.empty())
+        return;
+    ander.writeToFile(file);
+    setSVFOption("read-ander", file);
+    // the analyses read rather than write now
+    if (!Options::WriteAnder().empty() && Options::WriteAnder() != "ir_annotator")
+        ander.writeToFile(Options::WriteAnder());
+}
@@ -0,0 +1,57 @@
+#ifndef INCLUDE_DBANDERSEN_H_
+#define INCLUDE_DBANDERSEN_H_
+#include "WPA/Andersen.h"
+#include "GraphDBClient.h"
+#include <limits>
+
+namespace SVF
+{
+
+/// AndersenWaveDiff whose points-to sets are kept in the PTA graph: under
+/// -read-pta-from-db they are taken from there if they were computed on the PAG
+/// in GraphDB, under -pta-warm-start those the changed functions cannot have
+/// contributed to seed the solver; else they are solved from scratch. Under
+/// -write2db the sets solved are stored there, under -write2db-ind-calls the
+/// indirect call edges resolved are written into the CallGraph graph.
+class DBAndersenWaveDiff : public AndersenWaveDiff
+{
+public:
+    DBAndersenWaveDiff(SVFIR* _pag) : AndersenWaveDiff(_pag, AndersenWaveDiff_WPA, false) {}
+
+    void analyze() override;
+
+    /// WPAPass, SABER and MTA create their own Andersen analyses, which read the
+    /// file of -read-ander instead of solving: take or solve the points-to sets
+    /// here, store them, and hand them over in a file of this run set as
+    /// -read-ander; a -read-ander file given by the user is read, never written
+    static void shareResult(SVFIR* pag);
+
+private:
+    /// take or warm start the points-to sets from DB, false if neither applies
+    bool analyzeFromDB();
+    /// map the nodes of the stored run to this run through their keys, but those
+    /// of the functions in changedFuns, whose ordinals may name other nodes
+    void mapStoredIds(const DBPTAResult& result, const DBPAGNodeKeys& keys, const Set<std::string>& changedFuns,
+                      Map<NodeID, NodeID>& storedId2Id);
+    /// create the stored field objects whose base is mapped and not in changedNodes,
+    /// with the ids they get in this run; the others are mapped to unmappedId
+    void createGepObjs(const DBPTAResult& result, const Set<NodeID>& changedNodes,
+                       Map<NodeID, NodeID>& storedId2Id);
+    /// the id in this run of the node storedId of the stored run, false if it has none
+    bool getCurrentId(const Map<NodeID, NodeID>& storedId2Id, NodeID storedId, NodeID& id) const;
+    /// take the points-to sets of result, the field objects being created again
+    void loadResult(const DBPTAResult& result);
+    /// solve, seeded with the points-to sets of result untouched by the
+    /// functions whose content hash changed; false if the rows outside the functions changed
+    bool warmStart(const DBPTAResult& result);
+    /// write the points-to sets under -write2db, and the call edges
+    void storeResult();
+    /// write the indirect call edges resolved under -write2db-ind-calls
+    void storeIndCallEdges();
+
+    static constexpr NodeID unmappedId = std::numeric_limits<NodeID>::max();
+};
+
+} // namespace SVF
+
+#endif
@@ -0,0 +1,575 @@
+#include "DBBatchWriter.h"
+#include "Util/cJSON.h"
+#include <cctype>
+
+using namespace SVF;
+
+namespace
+{
+
+inline std::string trimStr(const std::string& str)
+{
+    size_t begin = str.find_first_not_of(" \t\n");
+    if (begin == std::string::npos)
+        return "";
+    size_t end = str.find_last_not_of(" \t\n");
+    return str.substr(begin, end - begin + 1);
+}
+
+/// return the position of the '}' closing the '{' at openPos,
+/// skipping anything inside single-quoted strings
+size_t findClosingBrace(const std::string& str, size_t openPos)
+{
+    int depth = 0;
+    bool inQuote = false;
+    for (size_t i = openPos; i < str.size(); ++i)
+    {
+        char c = str[i];
+        if (inQuote)
+        {
+            if (c == '\\')
+                ++i;
+            else if (c == '\'')
+                inQuote = false;
+            continue;
+        }
+        if (c == '\'')
+            inQuote = true;
+        else if (c == '{' || c == '[')
+            ++depth;
+        else if (c == '}' || c == ']')
+        {
+            --depth;
+            if (depth == 0)
+                return i;
+        }
+    }
+    return std::string::npos;
+}
+
+/// the value of a cypher literal as the text TuGraph parses a field from:
+/// 'it\'s' -> it's, numbers and booleans as they are
+std::string getLiteralText(const std::string& literal)
+{
+    if (literal.size() < 2 || literal.front() != '\'')
+        return literal;
+    std::string text;
+    for (size_t i = 1; i + 1 < literal.size(); ++i)
+    {
+        if (literal[i] == '\\' && i + 2 < literal.size())
+            ++i;
+        text.push_back(literal[i]);
+    }
+    return text;
+}
+
+/// str as a JSON string literal
+std::string toJSONString(const std::string& str)
+{
+    static const char hexDigits[] = "0123456789abcdef";
+    std::string out = "\"";
+    for (char c : str)
+    {
+        if (c == '"' || c == '\\')
+        {
+            out.push_back('\\');
+            out.push_back(c);
+        }
+        else if (static_cast<unsigned char>(c) < 0x20)
+        {
+            out += "\\u00";
+            out.push_back(hexDigits[(c >> 4) & 0xF]);
+            out.push_back(hexDigits[c & 0xF]);
+        }
+        else
+        {
+            out.push_back(c);
+        }
+    }
+    return out + "\"";
+}
+
+/// parse "Label{field:value}" starting at labelPos, return the position after the '}'
+size_t parseMatchPattern(const std::string& stmt, size_t labelPos, std::string& label,
+                         std::string& field, std::string& value)
+{
+    size_t open = stmt.find('{', labelPos);
+    if (open == std::string::npos)
+        return std::string::npos;
+    size_t close = findClosingBrace(stmt, open);
+    if (close == std::string::npos)
+        return std::string::npos;
+    label = trimStr(stmt.substr(labelPos, open - labelPos));
+    std::vector<std::string> keys;
+    std::vector<std::string> values;
+    if (!DBBatchWriter::splitCypherMap(stmt.substr(open + 1, close - open - 1), keys, &values) ||
+        keys.size() != 1)
+        return std::string::npos;
+    field = keys[0];
+    value = values[0];
+    return close + 1;
+}
+
+}
+
+DBBatchWriter::DBBatchWriter(lgraph::RpcClient* connection, const std::string& dbname, u32_t batchSize)
+    : connection(connection), dbname(dbname), batchSize(batchSize > 0 ? batchSize : 1), sentRows(0)
+{
+}
+
+DBBatchWriter::~DBBatchWriter()
+{
+    flush();
+}
+
+bool DBBatchWriter::splitCypherMap(const std::string& body, std::vector<std::string>& keys,
+                                   std::vector<std::string>* values)
+{
+    int depth = 0;
+    bool inQuote = false;
+    size_t itemBegin = 0;
+    for (size_t i = 0; i <= body.size(); ++i)
+    {
+        char c = i < body.size() ? body[i] : ',';
+        if (inQuote)
+        {
+            if (c == '\\')
+                ++i;
+            else if (c == '\'')
+                inQuote = false;
+            continue;
+        }
+        if (c == '\'')
+            inQuote = true;
+        else if (c == '{' || c == '[')
+            ++depth;
+        else if (c == '}' || c == ']')
+            --depth;
+        else if (c == ',' && depth == 0)
+        {
+            std::string item = body.substr(itemBegin, i - itemBegin);
+            itemBegin = i + 1;
+            if (trimStr(item).empty())
+                continue;
+            size_t colon = item.find(':');
+            if (colon == std::string::npos)
+                return false;
+            std::string key = trimStr(item.substr(0, colon));
+            if (key.empty())
+                return false;
+            for (char k : key)
+            {
+                if (!std::isalnum(static_cast<unsigned char>(k)) && k != '_')
+                    return false;
+            }
+            keys.push_back(key);
+            if (nullptr != values)
+                values->push_back(trimStr(item.substr(colon + 1)));
+        }
+    }
+    return !inQuote && depth == 0;
+}
+
+bool DBBatchWriter::parseNodeInsertStmt(const std::string& stmt, DBInsertRow& row)
+{
+    size_t pos = stmt.find("CREATE (n:");
+    if (pos == std::string::npos)
+        return false;
+    size_t labelPos = pos + std::string("CREATE (n:").size();
+    size_t open = stmt.find('{', labelPos);
+    if (open == std::string::npos)
+        return false;
+    size_t close = findClosingBrace(stmt, open);
+    if (close == std::string::npos)
+        return false;
+    row.label = trimStr(stmt.substr(labelPos, open - labelPos));
+    row.props = stmt.substr(open + 1, close - open - 1);
+    row.keys.clear();
+    row.stmt = stmt;
+    return !row.label.empty() && splitCypherMap(row.props, row.keys);
+}
+
+bool DBBatchWriter::parseEdgeInsertStmt(const std::string& stmt, DBInsertRow& row)
+{
+    size_t pos = stmt.find("MATCH (n:");
+    if (pos == std::string::npos)
+        return false;
+    pos = parseMatchPattern(stmt, pos + std::string("MATCH (n:").size(), row.srcLabel, row.srcField, row.srcValue);
+    if (pos == std::string::npos)
+        return false;
+    pos = stmt.find("(m:", pos);
+    if (pos == std::string::npos)
+        return false;
+    pos = parseMatchPattern(stmt, pos + std::string("(m:").size(), row.dstLabel, row.dstField, row.dstValue);
+    if (pos == std::string::npos)
+        return false;
+    pos = stmt.find("-[r:", pos);
+    if (pos == std::string::npos)
+        return false;
+    size_t labelPos = pos + std::string("-[r:").size();
+    size_t open = stmt.find('{', labelPos);
+    if (open == std::string::npos)
+        return false;
+    size_t close = findClosingBrace(stmt, open);
+    if (close == std::string::npos)
+        return false;
+    row.label = trimStr(stmt.substr(labelPos, open - labelPos));
+    row.props = stmt.substr(open + 1, close - open - 1);
+    row.keys.clear();
+    row.stmt = stmt;
+    return !row.label.empty() && splitCypherMap(row.props, row.keys);
+}
+
+void DBBatchWriter::addNodeStmt(const std::string& stmt)
+{
+    if (stmt.empty())
+        return;
+    DBInsertRow row;
+    if (parseNodeInsertStmt(stmt, row) && acceptRow(row, false))
+        addRow(row, false);
+    else
+        addStmt(stmt);
+}
+
+void DBBatchWriter::addEdgeStmt(const std::string& stmt)
+{
+    if (stmt.empty())
+        return;
+    DBInsertRow row;
+    if (parseEdgeInsertStmt(stmt, row) && acceptRow(row, true))
+        addRow(row, true);
+    else
+        addStmt(stmt);
+}
+
+void DBBatchWriter::addStmt(const std::string& stmt)
+{
+    flush();
+    if (execute(stmt))
+        sentRows++;
+}
+
+void DBBatchWriter::addRow(DBInsertRow& row, bool isEdge)
+{
+    // rows are grouped by label and property names so that every row of a
+    // group matches the same CREATE pattern (optional fields may be absent)
+    std::string groupKey = isEdge ? "E|" + row.label + "|" + row.srcLabel + "." + row.srcField +
+                                        "|" + row.dstLabel + "." + row.dstField
+                                  : "N|" + row.label;
+    for (const std::string& key : row.keys)
+        groupKey += "|" + key;
+
+    auto it = groupKey2Idx.find(groupKey);
+    u32_t idx = 0;
+    if (it == groupKey2Idx.end())
+    {
+        idx = groups.size();
+        groupKey2Idx[groupKey] = idx;
+        groups.push_back(RowGroup());
+        groups.back().isEdge = isEdge;
+    }
+    else
+    {
+        idx = it->second;
+    }
+    groups[idx].rows.push_back(std::move(row));
+    if (groups[idx].rows.size() >= batchSize)
+    {
+        if (isEdge)
+        {
+            flushNodes();
+            waitForNodeWrites();
+        }
+        flushGroup(idx);
+    }
+}
+
+void DBBatchWriter::flushNodes()
+{
+    for (u32_t i = 0; i < groups.size(); ++i)
+    {
+        if (!groups[i].isEdge)
+            flushGroup(i);
+    }
+}
+
+void DBBatchWriter::flush()
+{
+    flushNodes();
+    waitForNodeWrites();
+    for (u32_t i = 0; i < groups.size(); ++i)
+    {
+        if (groups[i].isEdge)
+            flushGroup(i);
+    }
+    waitForWrites();
+}
+
+void DBBatchWriter::flushGroup(u32_t groupIdx)
+{
+    if (groups[groupIdx].rows.empty())
+        return;
+    sentRows += writeGroup(groupIdx);
+    groups[groupIdx].rows.clear();
+}
+
+u32_t DBBatchWriter::writeGroup(u32_t groupIdx)
+{
+    u32_t written = 0;
+    for (const WriteBatch& batch : getWriteBatches(groupIdx))
+    {
+        written += writeBatch(connection, batch);
+    }
+    return written;
+}
+
+std::vector<DBBatchWriter::WriteBatch> DBBatchWriter::getWriteBatches(u32_t groupIdx) const
+{
+    const RowGroup& group = groups[groupIdx];
+    std::vector<WriteBatch> batches;
+    if (!group.isEdge)
+    {
+        std::vector<const DBInsertRow*> rows;
+        for (const DBInsertRow& row : group.rows)
+            rows.push_back(&row);
+        WriteBatch batch;
+        batch.stmt = getNodeBatchStmt(rows, batch);
+        batches.push_back(batch);
+    }
+    else
+    {
+        // split the edges into those whose endpoints both have a known VID and the rest
+        std::vector<const DBInsertRow*> vidRows;
+        std::vector<std::pair<s64_t, s64_t>> vids;
+        std::vector<const DBInsertRow*> matchRows;
+        if (edgeProcedure.empty())
+        {
+            for (const DBInsertRow& row : group.rows)
+                matchRows.push_back(&row);
+        }
+        else
+        {
+            std::lock_guard<std::mutex> lock(vidMtx);
+            for (const DBInsertRow& row : group.rows)
+            {
+                auto src = row.srcField == "id" ? vertexKey2Vid.find(getVertexKey(row.srcLabel, row.srcValue))
+                                                : vertexKey2Vid.end();
+                auto dst = row.dstField == "id" ? vertexKey2Vid.find(getVertexKey(row.dstLabel, row.dstValue))
+                                                : vertexKey2Vid.end();
+                if (src != vertexKey2Vid.end() && dst != vertexKey2Vid.end())
+                {
+                    vidRows.push_back(&row);
+                    vids.push_back(std::make_pair(src->second, dst->second));
+                }
+                else
+                {
+                    matchRows.push_back(&row);
+                }
+            }
+        }
+        if (!vidRows.empty())
+        {
+            WriteBatch batch;
+            batch.stmt = getEdgeProcedureRequest(vidRows, vids);
+            batch.byProcedure = true;
+            for (const DBInsertRow* row : vidRows)
+                batch.rowStmts.push_back(row->stmt);
+            batches.push_back(batch);
+        }
+        if (!matchRows.empty())
+        {
+            WriteBatch batch;
+            // a single row is sent as the statement it came from
+            if (matchRows.size() == 1)
+            {
+                batch.stmt = matchRows.front()->stmt;
+            }
+            else
+            {
+                batch.stmt = getEdgeBatchStmt(matchRows);
+                for (const DBInsertRow* row : matchRows)
+                    batch.rowStmts.push_back(row->stmt);
+            }
+            batches.push_back(batch);
+        }
+    }
+    for (WriteBatch& batch : batches)
+    {
+        batch.isEdge = group.isEdge;
+        batch.label = group.rows.front().label;
+        batch.numOfRows = batch.rowStmts.empty() ? 1 : batch.rowStmts.size();
+    }
+    return batches;
+}
+
+u32_t DBBatchWriter::writeBatch(lgraph::RpcClient* conn, const WriteBatch& batch)
+{
+    std::string result;
+    bool sent = false;
+    if (batch.byProcedure)
+    {
+        sent = nullptr != conn && conn->CallProcedure(result, "CPP", edgeProcedure, batch.stmt, 0.0, false, dbname);
+        if (!sent)
+            SVFUtil::outs() << "Warning: [DBBatchWriter] " << edgeProcedure << " failed on " << dbname << " "
+                            << result << "\n";
+    }
+    else
+    {
+        sent = execute(conn, batch.stmt, &result);
+    }
+    if (sent)
+    {
+        if (!batch.vertexKeys.empty())
+            recordVids(batch, result);
+        return batch.numOfRows;
+    }
+    if (batch.rowStmts.empty())
+        return 0;
+
+    // fall back to one statement per row so that a single bad row
+    // does not drop the whole batch, the VIDs of these nodes stay unknown
+    SVFUtil::outs() << "Warning: [DBBatchWriter] batch of " << batch.numOfRows
+                    << " " << batch.label << " rows failed, retrying row by row\n";
+    u32_t written = 0;
+    for (const std::string& stmt : batch.rowStmts)
+    {
+        if (execute(conn, stmt))
+            written++;
+    }
+    return written;
+}
+
+std::string DBBatchWriter::getNodeBatchStmt(const std::vector<const DBInsertRow*>& rows, WriteBatch& batch) const
+{
+    const DBInsertRow& first = *rows.front();
+    std::string rowsStr = "";
+    for (u32_t i = 0; i < rows.size(); ++i)
+    {
+        const DBInsertRow& row = *rows[i];
+        if (!rowsStr.empty())
+            rowsStr += ", ";
+        rowsStr += "{_idx:" + std::to_string(i) + (row.keys.empty() ? "" : ", " + row.props) + "}";
+
+        std::vector<std::string> keys;
+        std::vector<std::string> values;
+        splitCypherMap(row.props, keys, &values);
+        std::string vertexKey = "";
+        for (u32_t k = 0; k < keys.size(); ++k)
+        {
+            if (keys[k] == "id")
+                vertexKey = getVertexKey(row.label, values[k]);
+        }
+        if (!edgeProcedure.empty())
+            batch.vertexKeys.push_back(vertexKey);
+        if (rows.size() > 1)
+            batch.rowStmts.push_back(row.stmt);
+    }
+
+    std::string fieldsStr = "";
+    for (const std::string& key : first.keys)
+    {
+        if (!fieldsStr.empty())
+            fieldsStr += ", ";
+        fieldsStr += key + ":row." + key;
+    }
+    return "UNWIND [" + rowsStr + "] AS row CREATE (n:" + first.label + " {" + fieldsStr + "})" +
+           (edgeProcedure.empty() ? "" : " RETURN row._idx AS idx, id(n) AS vid");
+}
+
+std::string DBBatchWriter::getEdgeBatchStmt(const std::vector<const DBInsertRow*>& rows) const
+{
+    const DBInsertRow& first = *rows.front();
+    std::string rowsStr = "";
+    for (const DBInsertRow* row : rows)
+    {
+        if (!rowsStr.empty())
+            rowsStr += ", ";
+        rowsStr += "{_src_key:" + row->srcValue + ", _dst_key:" + row->dstValue;
+        if (!row->keys.empty())
+            rowsStr += ", " + row->props;
+        rowsStr += "}";
+    }
+
+    std::string fieldsStr = "";
+    for (const std::string& key : first.keys)
+    {
+        if (!fieldsStr.empty())
+            fieldsStr += ", ";
+        fieldsStr += key + ":row." + key;
+    }
+    // labeled property matches, index seeks on the endpoints
+    return "UNWIND [" + rowsStr + "] AS row MATCH (n:" + first.srcLabel + " {" + first.srcField +
+           ":row._src_key}), (m:" + first.dstLabel + " {" + first.dstField + ":row._dst_key}) CREATE (n)-[r:" +
+           first.label + (fieldsStr.empty() ? "" : " {" + fieldsStr + "}") + "]->(m)";
+}
+
+std::string DBBatchWriter::getEdgeProcedureRequest(const std::vector<const DBInsertRow*>& rows,
+                                                   const std::vector<std::pair<s64_t, s64_t>>& vids) const
+{
+    // {"label":"L", "fields":["k", ...], "edges":[[src vid, dst vid, "value of k", ...], ...]}
+    std::string fieldsStr = "";
+    for (const std::string& key : rows.front()->keys)
+    {
+        fieldsStr += (fieldsStr.empty() ? "" : ",") + toJSONString(key);
+    }
+    std::string edgesStr = "";
+    for (u32_t i = 0; i < rows.size(); ++i)
+    {
+        std::vector<std::string> keys;
+        std::vector<std::string> values;
+        splitCypherMap(rows[i]->props, keys, &values);
+        std::string edgeStr = std::to_string(vids[i].first) + "," + std::to_string(vids[i].second);
+        for (const std::string& value : values)
+        {
+            edgeStr += "," + toJSONString(getLiteralText(value));
+        }
+        edgesStr += (edgesStr.empty() ? "[" : ",[") + edgeStr + "]";
+    }
+    return "{\"label\":" + toJSONString(rows.front()->label) + ",\"fields\":[" + fieldsStr + "],\"edges\":[" +
+           edgesStr + "]}";
+}
+
+void DBBatchWriter::recordVids(const WriteBatch& batch, const std::string& result)
+{
+    cJSON* root = cJSON_Parse(result.c_str());
+    if (nullptr == root || !cJSON_IsArray(root))
+    {
+        SVFUtil::outs() << "Warning: [DBBatchWriter] Unexpected result of " << batch.label
+                        << " batch, edges to these nodes are matched on their id\n";
+        cJSON_Delete(root);
+        return;
+    }
+    std::lock_guard<std::mutex> lock(vidMtx);
+    cJSON* row;
+    cJSON_ArrayForEach(row, root)
+    {
+        cJSON* idx = cJSON_GetObjectItem(row, "idx");
+        cJSON* vid = cJSON_GetObjectItem(row, "vid");
+        if (nullptr == idx || nullptr == vid || !cJSON_IsNumber(idx) || !cJSON_IsNumber(vid))
+            continue;
+        u32_t i = static_cast<u32_t>(idx->valuedouble);
+        if (i < batch.vertexKeys.size() && !batch.vertexKeys[i].empty())
+            vertexKey2Vid[batch.vertexKeys[i]] = static_cast<s64_t>(vid->valuedouble);
+    }
+    cJSON_Delete(root);
+}
+
+bool DBBatchWriter::execute(const std::string& stmt)
+{
+    return execute(connection, stmt);
+}
+
+bool DBBatchWriter::execute(lgraph::RpcClient* conn, const std::string& stmt, std::string* result) const
+{
+    if (nullptr == conn)
+        return false;
+    std::string localResult;
+    std::string& res = nullptr != result ? *result : localResult;
+    bool ret = conn->CallCypher(res, stmt, dbname);
+    if (!ret)
+    {
+        SVFUtil::outs() << "Warning: [DBBatchWriter] Failed to write to db " << dbname
+                        << " " << res << "\n";
+    }
+    return ret;
+}
@@ -0,0 +1,162 @@
+#ifndef INCLUDE_DBBATCHWRITER_H_
+#define INCLUDE_DBBATCHWRITER_H_
+#include "Util/SVFUtil.h"
+#include "lgraph/lgraph_rpc_client.h"
+#include <mutex>
+
+namespace SVF
+{
+
+/// One vertex/edge row split out of a generated insert statement
+/// e.g. "CREATE (n:ValVar {id:1, kind:2})" or
+/// "MATCH (n:ValVar{id:1}), (m:ObjVar{id:2}) WHERE ... CREATE (n)-[r:AddrStmt{...}]->(m)"
+struct DBInsertRow
+{
+    std::string label;          ///< vertex label or edge label
+    std::string props;          ///< the property map body without the outer {}
+    std::vector<std::string> keys;  ///< property names in props, in order
+    /// edges only: label and match field/value of the src and dst vertices
+    std::string srcLabel;
+    std::string srcField;
+    std::string srcValue;
+    std::string dstLabel;
+    std::string dstField;
+    std::string dstValue;
+    std::string stmt;           ///< the original statement, replayed if a batch fails
+};
+
+/// Accumulate the single-row insert statements produced by GraphDBClient's
+/// *2DBString()/get*InsertStmt() and send them per label as
+///   UNWIND [{_idx:0, ...}, ...] AS row CREATE (n:Label {k:row.k, ...})
+///       RETURN row._idx AS idx, id(n) AS vid
+///   UNWIND [{_src_key:.., _dst_key:.., ...}, ...] AS row MATCH (n:SrcLabel {id:row._src_key}),
+///       (m:DstLabel {id:row._dst_key}) CREATE (n)-[r:Label {k:row.k, ...}]->(m)
+/// so that one RPC round trip carries up to batchSize rows. With an edge
+/// procedure (see setEdgeProcedure) the vertex ids (VIDs) returned for the nodes
+/// let their edges be added by VID inside the server, without an index lookup
+/// of their endpoints; edges to nodes of unknown VID still MATCH on their fields.
+/// Pending node rows are always sent before any edge row which refers to them.
+class DBBatchWriter
+{
+public:
+    DBBatchWriter(lgraph::RpcClient* connection, const std::string& dbname, u32_t batchSize);
+    virtual ~DBBatchWriter();
+
+    DBBatchWriter(const DBBatchWriter&) = delete;
+    DBBatchWriter& operator=(const DBBatchWriter&) = delete;
+
+    /// queue a "CREATE (n:Label {...})" statement
+    void addNodeStmt(const std::string& stmt);
+    /// queue a "MATCH (n:..), (m:..) ... CREATE (n)-[r:Label{...}]->(m)" statement
+    void addEdgeStmt(const std::string& stmt);
+    /// any other statement (e.g. a SET update), sent after the pending rows
+    virtual void addStmt(const std::string& stmt);
+    /// send every pending row, nodes first, and wait until they are written
+    void flush();
+    /// add the edges between nodes written here through the stored procedure
+    /// name of the graph (svf_add_edges), which takes their VIDs
+    inline void setEdgeProcedure(const std::string& name)
+    {
+        edgeProcedure = name;
+    }
+
+    inline const std::string& getDBName() const
+    {
+        return dbname;
+    }
+    /// number of rows/statements successfully sent so far
+    inline u32_t getNumOfSentRows() const
+    {
+        return sentRows;
+    }
+
+    /// statement parsing, shared with the other batched writers
+    static bool parseNodeInsertStmt(const std::string& stmt, DBInsertRow& row);
+    static bool parseEdgeInsertStmt(const std::string& stmt, DBInsertRow& row);
+    /// split the body of a cypher map literal "k1:v1, k2:'v,2'" into its keys/values
+    static bool splitCypherMap(const std::string& body, std::vector<std::string>& keys,
+                               std::vector<std::string>* values = nullptr);
+
+protected:
+    /// rows sharing label, match pattern and property names
+    struct RowGroup
+    {
+        bool isEdge;
+        std::vector<DBInsertRow> rows;
+    };
+
+    /// one statement carrying (part of) the rows of a group
+    struct WriteBatch
+    {
+        bool isEdge;
+        std::string label;
+        /// stmt: a cypher statement, or the request of the edge procedure
+        std::string stmt;
+        bool byProcedure = false;
+        u32_t numOfRows;
+        /// statements of the single rows, replayed if the batch fails
+        std::vector<std::string> rowStmts;
+        /// nodes only: vertex key (see getVertexKey) of each row, by _idx
+        std::vector<std::string> vertexKeys;
+    };
+
+    lgraph::RpcClient* connection;
+    std::string dbname;
+    u32_t batchSize;
+    u32_t sentRows;
+    /// groups are flushed in the order they are first seen
+    std::vector<RowGroup> groups;
+    Map<std::string, u32_t> groupKey2Idx;
+
+    /// whether a parsed row can be written as part of a group,
+    /// rejected rows are handed to addStmt() as they are
+    virtual bool acceptRow(const DBInsertRow&, bool)
+    {
+        return true;
+    }
+    /// write all rows of groups[groupIdx], return the number of rows written
+    virtual u32_t writeGroup(u32_t groupIdx);
+    /// writers sending groups asynchronously block here until every node row /
+    /// every row handed to writeGroup() so far has been written
+    virtual void waitForNodeWrites() {}
+    virtual void waitForWrites() {}
+
+    /// the statements writing groups[groupIdx]; with an edge procedure, edges to
+    /// nodes written by this writer are batched by VID, the others by their MATCH pattern
+    std::vector<WriteBatch> getWriteBatches(u32_t groupIdx) const;
+    /// send one batch through conn, falling back to row by row if it fails, and
+    /// record the VIDs of the nodes written; return the number of rows written.
+    /// Safe to call from several threads with different connections.
+    u32_t writeBatch(lgraph::RpcClient* conn, const WriteBatch& batch);
+
+    bool execute(const std::string& stmt);
+    /// send stmt to dbname through the given connection
+    bool execute(lgraph::RpcClient* conn, const std::string& stmt, std::string* result = nullptr) const;
+
+private:
+    std::string edgeProcedure;
+    /// VID of every node written so far, by vertex key
+    Map<std::string, s64_t> vertexKey2Vid;
+    mutable std::mutex vidMtx;
+
+    /// "label|value" of a vertex whose id property is value; edges can only
+    /// be resolved to VIDs when they match their endpoints on id
+    static inline std::string getVertexKey(const std::string& label, const std::string& value)
+    {
+        return label + "|" + value;
+    }
+    std::string getNodeBatchStmt(const std::vector<const DBInsertRow*>& rows, WriteBatch& batch) const;
+    std::string getEdgeBatchStmt(const std::vector<const DBInsertRow*>& rows) const;
+    /// the request of the edge procedure adding rows between the given VIDs
+    std::string getEdgeProcedureRequest(const std::vector<const DBInsertRow*>& rows,
+                                        const std::vector<std::pair<s64_t, s64_t>>& vids) const;
+    void recordVids(const WriteBatch& batch, const std::string& result);
+
+    void addRow(DBInsertRow& row, bool isEdge);
+    void flushGroup(u32_t groupIdx);
+    void flushNodes();
+};
+
+} // namespace SVF
+
+#endif
@@ -0,0 +1,49 @@
+#include "DBConnectionPool.h"
+
+using namespace SVF;
+
+DBConnectionPool::DBConnectionPool(u32_t size, const ConnectionFactory& factory)
+{
+    for (u32_t i = 0; i < size; ++i)
+    {
+        if (lgraph::RpcClient* connection = factory())
+        {
+            connections.push_back(connection);
+        }
+    }
+    if (connections.empty())
+    {
+        SVFUtil::outs() << "Warning: [DBConnectionPool] No DB connection could be created\n";
+    }
+    idleConnections = connections;
+}
+
+DBConnectionPool::~DBConnectionPool()
+{
+    for (lgraph::RpcClient* connection : connections)
+    {
+        delete connection;
+    }
+}
+
+lgraph::RpcClient* DBConnectionPool::acquire()
+{
+    std::unique_lock<std::mutex> lock(mtx);
+    if (connections.empty())
+        return nullptr;
+    connectionReleased.wait(lock, [this]() { return !idleConnections.empty(); });
+    lgraph::RpcClient* connection = idleConnections.back();
+    idleConnections.pop_back();
+    return connection;
+}
+
+void DBConnectionPool::release(lgraph::RpcClient* connection)
+{
+    if (nullptr == connection)
+        return;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        idleConnections.push_back(connection);
+    }
+    connectionReleased.notify_one();
+}
@@ -0,0 +1,43 @@
+#ifndef INCLUDE_DBCONNECTIONPOOL_H_
+#define INCLUDE_DBCONNECTIONPOOL_H_
+#include "Util/SVFUtil.h"
+#include "lgraph/lgraph_rpc_client.h"
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+
+namespace SVF
+{
+
+/// A fixed set of RpcClients shared by the writer threads.
+/// An RpcClient is not thread safe, so a connection is used by one thread at a
+/// time: acquire() blocks until one is idle and release() hands it back.
+class DBConnectionPool
+{
+public:
+    typedef std::function<lgraph::RpcClient*()> ConnectionFactory;
+
+    DBConnectionPool(u32_t size, const ConnectionFactory& factory);
+    ~DBConnectionPool();
+
+    DBConnectionPool(const DBConnectionPool&) = delete;
+    DBConnectionPool& operator=(const DBConnectionPool&) = delete;
+
+    lgraph::RpcClient* acquire();
+    void release(lgraph::RpcClient* connection);
+
+    inline u32_t size() const
+    {
+        return connections.size();
+    }
+
+private:
+    std::vector<lgraph::RpcClient*> connections;
+    std::vector<lgraph::RpcClient*> idleConnections;
+    std::mutex mtx;
+    std::condition_variable connectionReleased;
+};
+
+} // namespace SVF
+
+#endif
@@ -0,0 +1,108 @@
+#include "DBIdList.h"
+#include <cctype>
+
+using namespace SVF;
+
+static const char digitChars[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz_-";
+
+/// value of each digit character, -1 for the others
+static const struct DigitValues
+{
+    signed char values[256];
+    DigitValues()
+    {
+        for (int c = 0; c < 256; ++c)
+            values[c] = -1;
+        for (int i = 0; i < 64; ++i)
+            values[static_cast<unsigned char>(digitChars[i])] = static_cast<signed char>(i);
+    }
+} digitValues;
+
+void DBIdList::append(std::string& out, s64_t id, s64_t& prev)
+{
+    // differences of either sign become small unsigned numbers; computed
+    // unsigned so that they wrap instead of overflowing
+    s64_t delta = static_cast<s64_t>(static_cast<u64_t>(id) - static_cast<u64_t>(prev));
+    u64_t zigzag = (static_cast<u64_t>(delta) << 1) ^ static_cast<u64_t>(delta >> 63);
+    prev = id;
+    // 5 value bits per digit, bit 5 tells that more digits follow
+    while (zigzag >= 32)
+    {
+        out.push_back(digitChars[(zigzag & 31) | 32]);
+        zigzag >>= 5;
+    }
+    out.push_back(digitChars[zigzag]);
+}
+
+DBIdList::Reader::Reader(const char* begin, const char* end)
+    : pos(begin), limit(end), encoded(begin != end && *begin == marker), prev(0)
+{
+    if (encoded)
+    {
+        ++pos;
+    }
+}
+
+bool DBIdList::Reader::next(s64_t& id)
+{
+    if (encoded)
+    {
+        if (pos >= limit)
+        {
+            return false;
+        }
+        u64_t zigzag = 0;
+        u32_t shift = 0;
+        while (pos < limit && shift < 64)
+        {
+            int digit = digitValues.values[static_cast<unsigned char>(*pos++)];
+            if (digit < 0)
+            {
+                SVFUtil::outs() << "Warning: [DBIdList] Invalid character in id list\n";
+                pos = limit;
+                return false;
+            }
+            zigzag |= static_cast<u64_t>(digit & 31) << shift;
+            shift += 5;
+            if ((digit & 32) == 0)
+            {
+                prev = static_cast<s64_t>(static_cast<u64_t>(prev) + ((zigzag >> 1) ^ (~(zigzag & 1) + 1)));
+                id = prev;
+                return true;
+            }
+        }
+        SVFUtil::outs() << "Warning: [DBIdList] Truncated id list\n";
+        pos = limit;
+        return false;
+    }
+
+    // comma separated decimal ids
+    while (pos < limit && (*pos == ',' || std::isspace(static_cast<unsigned char>(*pos))))
+    {
+        ++pos;
+    }
+    if (pos >= limit)
+    {
+        return false;
+    }
+    bool negative = *pos == '-';
+    if (negative)
+    {
+        ++pos;
+    }
+    u64_t value = 0;
+    const char* digits = pos;
+    while (pos < limit && *pos >= '0' && *pos <= '9')
+    {
+        value = value * 10 + static_cast<u64_t>(*pos - '0');
+        ++pos;
+    }
+    if (digits == pos)
+    {
+        SVFUtil::outs() << "Warning: [DBIdList] Invalid character in id list\n";
+        pos = limit;
+        return false;
+    }
+    id = negative ? -static_cast<s64_t>(value) : static_cast<s64_t>(value);
+    return true;
+}
@@ -0,0 +1,63 @@
+#ifndef INCLUDE_DBIDLIST_H_
+#define INCLUDE_DBIDLIST_H_
+#include "Util/SVFUtil.h"
+
+namespace SVF
+{
+
+/// Compact encoding of the id lists kept in string properties (pag_edge_ids,
+/// all_icfg_nodes_ids, reachable_bbs, call_pe_ids, ...):
+///   '~' then, for every id, the zigzag encoded difference to the id before it
+///   as a varint of 5 bit digits, lowest first, one character per digit
+/// Ids of one list are mostly close to each other, so an id takes one or two
+/// characters instead of its decimal digits and a comma. The 64 digit characters
+/// [0-9A-Za-z_-] need no escaping in a cypher string literal and are none of the
+/// separators ",:[]{}" of the maps the lists are nested in.
+/// Reader also accepts the former comma separated lists of graphs written before.
+class DBIdList
+{
+public:
+    static constexpr char marker = '~';
+
+    /// the encoding of the ids getId(*it) of [begin, end), "" if it is empty
+    template <typename Iter, typename GetId>
+    static std::string encode(Iter begin, Iter end, GetId getId)
+    {
+        std::string out;
+        if (begin == end)
+        {
+            return out;
+        }
+        out.push_back(marker);
+        s64_t prev = 0;
+        for (; begin != end; ++begin)
+        {
+            append(out, static_cast<s64_t>(getId(*begin)), prev);
+        }
+        return out;
+    }
+
+    /// append id to the encoded list out, prev being the id appended last (0 for the first)
+    static void append(std::string& out, s64_t id, s64_t& prev);
+
+    /// walk the ids of an encoded or comma separated list in place
+    class Reader
+    {
+    public:
+        Reader(const char* begin, const char* end);
+        explicit Reader(const std::string& str) : Reader(str.data(), str.data() + str.size()) {}
+
+        /// the next id of the list, false once every id has been read
+        bool next(s64_t& id);
+
+    private:
+        const char* pos;
+        const char* limit;
+        bool encoded;
+        s64_t prev;
+    };
+};
+
+} // namespace SVF
+
+#endif
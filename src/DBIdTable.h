@@ -0,0 +1,66 @@
+#ifndef INCLUDE_DBIDTABLE_H_
+#define INCLUDE_DBIDTABLE_H_
+#include "Util/SVFUtil.h"
+#include <algorithm>
+#include <vector>
+
+namespace SVF
+{
+
+/// Objects of a graph read from DB by their id. SVF node and edge ids are
+/// dense from 0, so a flat vector replaces the hash map the lookups of the
+/// loader would otherwise probe; reserve() it with the number of rows in DB.
+template <typename T>
+class DBIdTable
+{
+public:
+    typedef typename std::vector<T*>::const_iterator const_iterator;
+
+    /// make room for the ids [0, numOfIds)
+    inline void reserve(size_t numOfIds)
+    {
+        if (table.size() < numOfIds)
+        {
+            table.resize(numOfIds, nullptr);
+        }
+    }
+    /// the object of id, nullptr if there is none
+    inline T* find(s64_t id) const
+    {
+        return id >= 0 && static_cast<size_t>(id) < table.size() ? table[id] : nullptr;
+    }
+    inline void set(s64_t id, T* obj)
+    {
+        if (id < 0)
+        {
+            return;
+        }
+        if (static_cast<size_t>(id) >= table.size())
+        {
+            // ids beyond the reserved count, e.g. rows added since it was taken
+            table.resize(std::max(static_cast<size_t>(id) + 1, table.size() * 2), nullptr);
+        }
+        table[id] = obj;
+    }
+    /// every slot, nullptr for the ids without object
+    inline const_iterator begin() const
+    {
+        return table.begin();
+    }
+    inline const_iterator end() const
+    {
+        return table.end();
+    }
+    /// release the memory of the table
+    inline void clear()
+    {
+        std::vector<T*>().swap(table);
+    }
+
+private:
+    std::vector<T*> table;
+};
+
+} // namespace SVF
+
+#endif
@@ -0,0 +1,48 @@
+#include "DBLoadSession.h"
+
+using namespace SVF;
+
+static thread_local DBLoadSession* currentSession = nullptr;
+
+DBLoadSession::Scope::Scope(DBLoadSession* session) : prev(currentSession)
+{
+    currentSession = session;
+}
+
+DBLoadSession::Scope::~Scope()
+{
+    currentSession = prev;
+}
+
+DBLoadSession::DBLoadSession()
+{
+}
+
+DBLoadSession::~DBLoadSession()
+{
+    clear();
+}
+
+DBLoadSession* DBLoadSession::getCurrent()
+{
+    return currentSession;
+}
+
+void DBLoadSession::clear()
+{
+    id2funObjVarsMap.clear();
+    id2SVFVarMap.clear();
+    id2RetICFGNodeMap.clear();
+    id2CallPEMap.clear();
+    id2RetPEMap.clear();
+    edgeId2SVFStmtMap.clear();
+    std::vector<DeferredPAGNodeAttrs>().swap(deferredPAGNodeAttrs);
+    std::vector<DeferredGepValVarAttrs>().swap(deferredGepValVarAttrs);
+    std::vector<DeferredFunObjVarAttrs>().swap(deferredFunObjVarAttrs);
+    Set<NodeID>().swap(loadedFunObjVarIds);
+    Map<int, std::vector<std::pair<CallGraphEdge*, bool>>>().swap(pendingCallSites);
+    Map<CallCFGEdge*, std::string>().swap(callCFGEdge2CallPEStrMap);
+    Map<RetCFGEdge*, int>().swap(retCFGEdge2RetPEStrMap);
+    Map<ICFGNode*, std::string>().swap(icfgNode2StmtsStrMap);
+    Map<SVFBasicBlock*, std::string>().swap(bb2AllICFGNodeIdstrMap);
+}
@@ -0,0 +1,118 @@
+#ifndef INCLUDE_DBLOADSESSION_H_
+#define INCLUDE_DBLOADSESSION_H_
+#include "DBIdTable.h"
+#include "Util/SVFUtil.h"
+
+namespace SVF
+{
+class FunObjVar;
+class SVFVar;
+class SVFStmt;
+class CallPE;
+class RetPE;
+class ICFGNode;
+class RetICFGNode;
+class CallCFGEdge;
+class RetCFGEdge;
+class CallGraphEdge;
+class SVFBasicBlock;
+
+/// The attributes of a PAG node which refer to the ICFG, CallGraph or
+/// BasicBlockGraph, kept from the single read of the PAG nodes until
+/// updatePAGNodesFromDB() can resolve them
+struct DeferredPAGNodeAttrs
+{
+    NodeID id;
+    u32_t typeIdx;      ///< label of the node, index into the PAG node labels
+    int icfgNodeId;
+    /// cg_node_id (ArgValVar), call_graph_node_id (RetValPN, VarArgValPN),
+    /// fun_obj_var_node_id (FunValVar), base_val_id (GepValVar) or
+    /// real_def_fun_node_id (FunObjVar); -1 for the other labels
+    int refNodeId;
+    /// GepValVar/FunObjVar: index of their other attributes below
+    u32_t extIdx;
+};
+
+struct DeferredGepValVarAttrs
+{
+    s64_t apFldIdx;
+    int apGepPointeeTypeId;
+    int llvmVarInstId;
+    std::string apIdxOperandPairs;
+};
+
+struct DeferredFunObjVarAttrs
+{
+    int exitBBId;
+    std::string reachableBBs;
+    std::string dtBBsMap;
+    std::string pdtBBsMap;
+    std::string dfBBsMap;
+    std::string bb2LoopMap;
+    std::string bb2PDomLevel;
+    std::string bb2PIDom;
+};
+
+/// The state of one read of a program from DB: the objects read so far by id
+/// and the references waiting for their target to be read. GraphDBClient reads
+/// into the session current on the calling thread (see Scope), or into its own
+/// one, so that several programs can be read in one process, each on its own
+/// thread. The session only owns its tables, the SVF objects belong to the SVFIR;
+/// clear() or the destructor frees them all at once.
+class DBLoadSession
+{
+public:
+    /// make session current on the calling thread for the lifetime of the scope
+    class Scope
+    {
+    public:
+        explicit Scope(DBLoadSession* session);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        DBLoadSession* prev;
+    };
+
+    DBLoadSession();
+    ~DBLoadSession();
+
+    DBLoadSession(const DBLoadSession&) = delete;
+    DBLoadSession& operator=(const DBLoadSession&) = delete;
+
+    /// the session of the innermost Scope of the calling thread, nullptr if none
+    static DBLoadSession* getCurrent();
+
+    /// free every table, the session can then read another program
+    void clear();
+
+    /// the objects read so far by id, sized from the row counts in DB
+    DBIdTable<FunObjVar> id2funObjVarsMap;
+    DBIdTable<SVFVar> id2SVFVarMap;
+    DBIdTable<RetICFGNode> id2RetICFGNodeMap;
+    DBIdTable<CallPE> id2CallPEMap;
+    DBIdTable<RetPE> id2RetPEMap;
+    DBIdTable<SVFStmt> edgeId2SVFStmtMap;
+
+    /// references recorded while the rows are parsed, resolved once their targets are read
+    Map<CallCFGEdge*, std::string> callCFGEdge2CallPEStrMap;
+    Map<RetCFGEdge*, int> retCFGEdge2RetPEStrMap;
+    Map<ICFGNode*, std::string> icfgNode2StmtsStrMap;
+    Map<SVFBasicBlock*, std::string> bb2AllICFGNodeIdstrMap;
+
+    /// rows of the PAG nodes kept for updatePAGNodesFromDB()
+    std::vector<DeferredPAGNodeAttrs> deferredPAGNodeAttrs;
+    std::vector<DeferredGepValVarAttrs> deferredGepValVarAttrs;
+    std::vector<DeferredFunObjVarAttrs> deferredFunObjVarAttrs;
+
+    /// -db-entry: the functions read by loadFunctionsFromDB() so far, and the
+    /// CallGraph edges waiting for the CallICFGNode of their call sites
+    Set<NodeID> loadedFunObjVarIds;
+    Map<int, std::vector<std::pair<CallGraphEdge*, bool>>> pendingCallSites;
+};
+
+} // namespace SVF
+
+#endif
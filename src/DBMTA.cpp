@@ -0,0 +1,107 @@
+#include "DBMTA.h"
+#include "MTA/MHP.h"
+#include "MTA/LockAnalysis.h"
+#include "WPA/Andersen.h"
+#include <algorithm>
+
+using namespace SVF;
+
+bool DBMTA::runOnModule(SVFIR* pag)
+{
+    GraphDBClient& client = GraphDBClient::getInstance();
+    if (ReadMTAFromDB())
+    {
+        DBThreadAnalysisResult result;
+        if (client.readThreadAnalysisFromDB(client.getConnection(), "ThreadAnalysis", result))
+        {
+            detectFromDB(pag, result);
+            return false;
+        }
+        SVFUtil::outs() << "Warning: [DBMTA] no ThreadAnalysis graph of this PAG in DB, computing\n";
+    }
+    bool changed = MTA::runOnModule(pag);
+    if ((Write2DB() || client.isOfflineMode()) && nullptr != computedMHP && nullptr != computedLocksets)
+    {
+        client.insertThreadAnalysis2db(computedMHP, computedLocksets, pag);
+    }
+    return changed;
+}
+
+MHP* DBMTA::computeMHP()
+{
+    computedMHP = MTA::computeMHP();
+    return computedMHP;
+}
+
+LockAnalysis* DBMTA::computeLocksets(TCT* tct)
+{
+    computedLocksets = MTA::computeLocksets(tct);
+    return computedLocksets;
+}
+
+void DBMTA::detectFromDB(SVFIR* pag, const DBThreadAnalysisResult& result)
+{
+    Map<NodeID, const DBThreadAnalysisResult::Stmt*> stmts;
+    for (const DBThreadAnalysisResult::Stmt& stmt : result.stmts)
+    {
+        stmts[stmt.id] = &stmt;
+    }
+    // the contexts being folded per thread, s and t may happen in parallel if
+    // a thread of t interleaves with one of s and the other way round
+    auto interleaves = [](const DBThreadAnalysisResult::Stmt* s, size_t i, NodeID tid)
+    {
+        const std::vector<NodeID>& tids = s->interleavingThreadIds[i];
+        return std::find(tids.begin(), tids.end(), tid) != tids.end();
+    };
+    auto mayHappenInParallel = [&interleaves](const DBThreadAnalysisResult::Stmt* s, const DBThreadAnalysisResult::Stmt* t)
+    {
+        for (size_t i = 0; i < s->threadIds.size(); ++i)
+        {
+            for (size_t j = 0; j < t->threadIds.size(); ++j)
+            {
+                if (interleaves(s, i, t->threadIds[j]) && interleaves(t, j, s->threadIds[i]))
+                    return true;
+            }
+        }
+        return false;
+    };
+    // the locks stored are held in every context
+    auto isProtectedByCommonLock = [](const DBThreadAnalysisResult::Stmt* s, const DBThreadAnalysisResult::Stmt* t)
+    {
+        for (NodeID lock : s->lockSiteIds)
+        {
+            if (std::find(t->lockSiteIds.begin(), t->lockSiteIds.end(), lock) != t->lockSiteIds.end())
+                return true;
+        }
+        return false;
+    };
+    auto getStmt = [&stmts](const SVFStmt* stmt) -> const DBThreadAnalysisResult::Stmt*
+    {
+        if (nullptr == stmt->getICFGNode())
+            return nullptr;
+        auto it = stmts.find(stmt->getICFGNode()->getId());
+        return it != stmts.end() ? it->second : nullptr;
+    };
+
+    PointerAnalysis* pta = AndersenWaveDiff::createAndersenWaveDiff(pag);
+    u32_t numOfRaces = 0;
+    for (const SVFStmt* store : pag->getSVFStmtSet(SVFStmt::Store))
+    {
+        const DBThreadAnalysisResult::Stmt* s = getStmt(store);
+        if (nullptr == s)
+            continue;
+        for (const SVFStmt* load : pag->getSVFStmtSet(SVFStmt::Load))
+        {
+            const DBThreadAnalysisResult::Stmt* t = getStmt(load);
+            if (nullptr != t && mayHappenInParallel(s, t) && pta->alias(load->getSrcID(), store->getDstID()) &&
+                !isProtectedByCommonLock(s, t))
+            {
+                SVFUtil::outs() << SVFUtil::bugMsg1("race pair(") << " store: " << store->toString()
+                                << ", load: " << load->toString() << SVFUtil::bugMsg1(")") << "\n";
+                ++numOfRaces;
+            }
+        }
+    }
+    SVFUtil::outs() << "Races from the stored thread analysis (" << result.threads.size() << " threads, "
+                    << result.stmts.size() << " statements): " << numOfRaces << "\n";
+}
@@ -0,0 +1,31 @@
+#ifndef INCLUDE_DBMTA_H_
+#define INCLUDE_DBMTA_H_
+#include "MTA/MTA.h"
+#include "GraphDBClient.h"
+
+namespace SVF
+{
+
+/// MTA which keeps the threads, the fork/join sites, the may-happen-in-parallel
+/// relation and the locks held of its run; under -write2db they are stored in
+/// the ThreadAnalysis graph, under -read-mta-from-db the races are checked
+/// with those stored instead of computing them
+class DBMTA : public MTA
+{
+public:
+    bool runOnModule(SVFIR* pag) override;
+    MHP* computeMHP() override;
+    LockAnalysis* computeLocksets(TCT* tct) override;
+
+private:
+    /// the store/load pairs which may alias, may happen in parallel and are
+    /// protected by no common lock, as MTA::detect() with the stored analysis
+    void detectFromDB(SVFIR* pag, const DBThreadAnalysisResult& result);
+
+    MHP* computedMHP = nullptr;
+    LockAnalysis* computedLocksets = nullptr;
+};
+
+} // namespace SVF
+
+#endif
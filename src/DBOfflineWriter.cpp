@@ -0,0 +1,201 @@
+#include "DBOfflineWriter.h"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+using namespace SVF;
+
+DBOfflineWriter::DBOfflineWriter(const std::string& dir, const std::string& dbname,
+                                 const std::vector<std::string>& schemaFiles, u32_t batchSize)
+    : DBBatchWriter(nullptr, dbname, batchSize), outputDir(dir), graphDir(dir + "/" + dbname),
+      schema(cJSON_CreateArray()), files(cJSON_CreateArray())
+{
+    std::error_code ec;
+    std::filesystem::remove_all(graphDir, ec);
+    std::filesystem::create_directories(graphDir, ec);
+    if (ec)
+    {
+        SVFUtil::outs() << "Warning: [DBOfflineWriter] Failed to create " << graphDir
+                        << ": " << ec.message() << "\n";
+    }
+
+    // the import config carries the same schema as the live loadSchema()
+    for (const std::string& path : schemaFiles)
+    {
+        std::ifstream in(path);
+        std::stringstream buffer;
+        buffer << in.rdbuf();
+        cJSON* root = cJSON_Parse(buffer.str().c_str());
+        cJSON* entries = root ? cJSON_GetObjectItem(root, "schema") : nullptr;
+        if (nullptr == entries || !cJSON_IsArray(entries))
+        {
+            SVFUtil::outs() << "Warning: [DBOfflineWriter] Invalid schema file: " << path << "\n";
+            cJSON_Delete(root);
+            continue;
+        }
+        cJSON* entry;
+        cJSON_ArrayForEach(entry, entries)
+        {
+            cJSON* label = cJSON_GetObjectItem(entry, "label");
+            cJSON* primary = cJSON_GetObjectItem(entry, "primary");
+            if (label && cJSON_IsString(label) && primary && cJSON_IsString(primary))
+                label2Primary[label->valuestring] = primary->valuestring;
+            cJSON_AddItemToArray(schema, cJSON_Duplicate(entry, true));
+        }
+        cJSON_Delete(root);
+    }
+}
+
+DBOfflineWriter::~DBOfflineWriter()
+{
+    // flush here, the base destructor can no longer reach writeGroup()
+    flush();
+    writeImportConfig();
+    cJSON_Delete(schema);
+    cJSON_Delete(files);
+}
+
+bool DBOfflineWriter::acceptRow(const DBInsertRow& row, bool isEdge)
+{
+    if (!isEdge)
+        return true;
+    auto src = label2Primary.find(row.srcLabel);
+    auto dst = label2Primary.find(row.dstLabel);
+    return src != label2Primary.end() && src->second == row.srcField &&
+           dst != label2Primary.end() && dst->second == row.dstField;
+}
+
+u32_t DBOfflineWriter::writeGroup(u32_t groupIdx)
+{
+    const RowGroup& group = groups[groupIdx];
+    const DBInsertRow& first = group.rows.front();
+    if (groupFiles.size() <= groupIdx)
+        groupFiles.resize(groupIdx + 1);
+
+    bool created = !groupFiles[groupIdx].empty();
+    if (!created)
+    {
+        std::string fileName = first.label;
+        if (group.isEdge)
+            fileName += "_" + first.srcLabel + "_" + first.dstLabel;
+        fileName += "_" + std::to_string(groupIdx) + ".jsonl";
+        groupFiles[groupIdx] = graphDir + "/" + fileName;
+
+        cJSON* desc = cJSON_CreateObject();
+        cJSON_AddStringToObject(desc, "path", groupFiles[groupIdx].c_str());
+        cJSON_AddStringToObject(desc, "format", "JSON");
+        cJSON_AddStringToObject(desc, "label", first.label.c_str());
+        cJSON* columns = cJSON_CreateArray();
+        if (group.isEdge)
+        {
+            cJSON_AddStringToObject(desc, "SRC_ID", first.srcLabel.c_str());
+            cJSON_AddStringToObject(desc, "DST_ID", first.dstLabel.c_str());
+            cJSON_AddItemToArray(columns, cJSON_CreateString("SRC_ID"));
+            cJSON_AddItemToArray(columns, cJSON_CreateString("DST_ID"));
+        }
+        for (const std::string& key : first.keys)
+            cJSON_AddItemToArray(columns, cJSON_CreateString(key.c_str()));
+        cJSON_AddItemToObject(desc, "columns", columns);
+        cJSON_AddItemToArray(files, desc);
+    }
+
+    std::ofstream out(groupFiles[groupIdx], created ? std::ios::app : std::ios::trunc);
+    if (!out.is_open())
+    {
+        SVFUtil::outs() << "Warning: [DBOfflineWriter] Failed to open " << groupFiles[groupIdx] << "\n";
+        return 0;
+    }
+    u32_t written = 0;
+    for (const DBInsertRow& row : group.rows)
+    {
+        std::vector<std::string> keys;
+        std::vector<std::string> values;
+        splitCypherMap(row.props, keys, &values);
+        std::string line = "[";
+        if (group.isEdge)
+            line += cypherLiteral2Json(row.srcValue) + "," + cypherLiteral2Json(row.dstValue);
+        for (const std::string& value : values)
+        {
+            if (line.size() > 1)
+                line += ",";
+            line += cypherLiteral2Json(value);
+        }
+        out << line << "]\n";
+        written++;
+    }
+    return written;
+}
+
+void DBOfflineWriter::addStmt(const std::string& stmt)
+{
+    if (appendPostImportStmt(outputDir, dbname, stmt))
+        sentRows++;
+}
+
+bool DBOfflineWriter::appendPostImportStmt(const std::string& dir, const std::string& dbname,
+                                           const std::string& stmt)
+{
+    std::error_code ec;
+    std::filesystem::create_directories(dir + "/" + dbname, ec);
+    std::ofstream out(dir + "/" + dbname + "/post_import.cypher", std::ios::app);
+    if (!out.is_open())
+    {
+        SVFUtil::outs() << "Warning: [DBOfflineWriter] Failed to write post import statement for "
+                        << dbname << "\n";
+        return false;
+    }
+    out << stmt << ";\n";
+    return true;
+}
+
+std::string DBOfflineWriter::cypherLiteral2Json(const std::string& literal)
+{
+    if (literal.size() < 2 || literal.front() != '\'' || literal.back() != '\'')
+        return literal;
+
+    std::string json = "\"";
+    for (size_t i = 1; i + 1 < literal.size(); ++i)
+    {
+        char c = literal[i];
+        // cypher escapes: \' and \\ ; anything else is taken as it is
+        if (c == '\\' && i + 2 < literal.size() && (literal[i + 1] == '\'' || literal[i + 1] == '\\'))
+            c = literal[++i];
+        if (c == '"' || c == '\\')
+        {
+            json += '\\';
+            json += c;
+        }
+        else if (static_cast<unsigned char>(c) < 0x20)
+        {
+            char buf[8];
+            snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned char>(c));
+            json += buf;
+        }
+        else
+        {
+            json += c;
+        }
+    }
+    return json + "\"";
+}
+
+void DBOfflineWriter::writeImportConfig()
+{
+    cJSON* conf = cJSON_CreateObject();
+    cJSON_AddItemToObject(conf, "schema", cJSON_Duplicate(schema, true));
+    cJSON_AddItemToObject(conf, "files", cJSON_Duplicate(files, true));
+    char* text = cJSON_Print(conf);
+    std::ofstream out(graphDir + "/import.conf", std::ios::trunc);
+    if (out.is_open() && nullptr != text)
+    {
+        out << text << "\n";
+        SVFUtil::outs() << "Offline import files of " << dbname << " written to " << graphDir << "\n";
+    }
+    else
+    {
+        SVFUtil::outs() << "Warning: [DBOfflineWriter] Failed to write " << graphDir << "/import.conf\n";
+    }
+    cJSON_free(text);
+    cJSON_Delete(conf);
+}
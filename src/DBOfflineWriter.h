@@ -0,0 +1,52 @@
+#ifndef INCLUDE_DBOFFLINEWRITER_H_
+#define INCLUDE_DBOFFLINEWRITER_H_
+#include "DBBatchWriter.h"
+#include "Util/cJSON.h"
+
+namespace SVF
+{
+
+/// Write the rows of one graph as TuGraph offline import files instead of
+/// sending them to the server (-write2db-offline=<dir>):
+///   <dir>/<graph>/<Label>_<n>.jsonl   one JSON array per row, columns as in import.conf
+///   <dir>/<graph>/import.conf         schema (from src/DBSchema/*.json) + file descriptions
+///   <dir>/<graph>/post_import.cypher  statements which are not plain inserts, run after import
+/// so that the graph can be loaded with
+///   lgraph_import -c <dir>/<graph>/import.conf --graph <graph>
+class DBOfflineWriter : public DBBatchWriter
+{
+public:
+    DBOfflineWriter(const std::string& dir, const std::string& dbname,
+                    const std::vector<std::string>& schemaFiles, u32_t batchSize);
+    ~DBOfflineWriter() override;
+
+    /// statements which cannot be imported are kept for after the import
+    void addStmt(const std::string& stmt) override;
+
+    /// append a statement to <dir>/<dbname>/post_import.cypher
+    static bool appendPostImportStmt(const std::string& dir, const std::string& dbname,
+                                     const std::string& stmt);
+    /// convert a cypher literal (123, true, 'str') to its JSON form
+    static std::string cypherLiteral2Json(const std::string& literal);
+
+protected:
+    /// edges can only be imported when they refer to the primary key of both ends
+    bool acceptRow(const DBInsertRow& row, bool isEdge) override;
+    u32_t writeGroup(u32_t groupIdx) override;
+
+private:
+    std::string outputDir;
+    std::string graphDir;
+    cJSON* schema;
+    Map<std::string, std::string> label2Primary;
+    /// import file of each row group, empty until the group is first written
+    std::vector<std::string> groupFiles;
+    /// file descriptions for import.conf, in the order the files are created
+    cJSON* files;
+
+    void writeImportConfig();
+};
+
+} // namespace SVF
+
+#endif
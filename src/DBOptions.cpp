@@ -1,4 +1,7 @@
 #include "DBOptions.h"
+#include <cstdio>
+#include <cstdlib>
+#include <unistd.h>
 
 namespace SVF {
 
@@ -10,7 +13,129 @@ const Option<bool> Write2DBOpt("write2db",
                                "Write analysis/results to GraphDB",
                                false);
 
+const Option<std::string> Write2DBOfflineOpt("write2db-offline",
+                                             "Write the graphs as TuGraph offline import files (lgraph_import) into the given directory instead of the server",
+                                             "");
+
+const Option<bool> Write2DBIncrementalOpt("write2db-incremental",
+                                          "With -write2db, keep the graphs in GraphDB and replace only the rows of the functions whose content hash differs from the one stored by the previous write",
+                                          false);
+
+const Option<u32_t> DBBatchSizeOpt("db-batch-size",
+                                   "Number of rows sent per UNWIND statement when writing to GraphDB (1 disables batching)",
+                                   1000);
+
+const Option<u32_t> DBPageSizeOpt("db-page-size",
+                                  "Number of rows fetched per keyset page when reading from GraphDB",
+                                  1000);
+
+const Option<u32_t> DBThreadsOpt("db-threads",
+                                "Number of connections/threads used to serialize and send rows to GraphDB (1 writes on the main connection)",
+                                4);
+
+const Option<u32_t> DBPrefetchPagesOpt("db-prefetch-pages",
+                                      "Number of decoded pages a background thread keeps ahead of graph construction when reading from GraphDB (0 reads synchronously)",
+                                      4);
+
+const Option<std::string> DBSnapshotOpt("db-snapshot",
+                                        "Keep the query results of -read-from-db in the given file and answer later reads from it while the graphs in GraphDB are unchanged",
+                                        "");
+
+const Option<std::string> DBEntryOpt("db-entry",
+                                     "With -read-from-db, load only the functions reachable in the CallGraph from the given comma separated functions, the other function bodies are left in GraphDB",
+                                     "");
+
+const Option<bool> ReadPTAFromDBOpt("read-pta-from-db",
+                                    "Take the Andersen points-to sets stored in the PTA graph by a run with -write2db instead of solving, if they were computed on the PAG in GraphDB",
+                                    false);
+
+const Option<bool> PTAWarmStartOpt("pta-warm-start",
+                                   "Seed the Andersen solver with the points-to sets stored in the PTA graph which the functions changed since, by content hash, cannot have contributed to",
+                                   false);
+
+const Option<bool> ReadSVFGFromDBOpt("read-svfg-from-db",
+                                     "Read the SVFG stored by a SABER run with -write2db instead of building its memory SSA, if it was built on the PAG in GraphDB",
+                                     false);
+
+const Option<bool> ReadMTAFromDBOpt("read-mta-from-db",
+                                    "Check races with the threads, may-happen-in-parallel pairs and locks stored in the ThreadAnalysis graph by a run with -write2db instead of computing them, if they were computed on the PAG in GraphDB",
+                                    false);
+
+const Option<bool> Write2DBIndCallsOpt("write2db-ind-calls",
+                                       "After the Andersen analysis, write the indirect call edges it resolved into the CallGraph graph, so that later reads start from them",
+                                       false);
+
+const Option<bool> DBProceduresOpt("db-procedures",
+                                   "Load the stored procedures built with this tool (svf_icfg_reach, svf_points_to) into the ICFG and PAG graphs, to answer reachability and points-to queries in the server",
+                                   false);
+
+const Option<std::string> DBProcedureDirOpt("db-procedure-dir",
+                                            "Directory of the stored procedures (svf_icfg_reach.so, ...), by default the procedures directory installed next to the bin directory of this tool",
+                                            "");
+
+const Option<std::string> DBQueryPtsOpt("db-query-pts",
+                                        "Print the objects which the given comma separated PAG nodes point to through copies, as answered by the svf_points_to procedure of the PAG graph",
+                                        "");
+
+const Option<std::string> DBQueryReachOpt("db-query-reach",
+                                          "Print the ICFG nodes reachable from the given comma separated ICFG nodes, as answered by the svf_icfg_reach procedure of the ICFG graph",
+                                          "");
+
 bool ReadFromDB() { return ReadFromDBOpt(); }
 bool Write2DB()   { return Write2DBOpt(); }
+std::string Write2DBOfflineDir() { return Write2DBOfflineOpt(); }
+bool Write2DBIncremental() { return Write2DBIncrementalOpt(); }
+u32_t DBBatchSize() { return DBBatchSizeOpt(); }
+u32_t DBPageSize() { return DBPageSizeOpt(); }
+u32_t DBThreads() { return DBThreadsOpt(); }
+u32_t DBPrefetchPages() { return DBPrefetchPagesOpt(); }
+std::string DBSnapshotFile() { return DBSnapshotOpt(); }
+bool DBLazyLoad() { return !DBEntryOpt().empty(); }
+std::string DBEntryFunctions() { return DBEntryOpt(); }
+bool ReadPTAFromDB() { return ReadPTAFromDBOpt(); }
+bool PTAWarmStart() { return PTAWarmStartOpt(); }
+bool ReadSVFGFromDB() { return ReadSVFGFromDBOpt(); }
+bool ReadMTAFromDB() { return ReadMTAFromDBOpt(); }
+bool Write2DBIndCalls() { return Write2DBIndCallsOpt(); }
+bool DBProcedures() { return DBProceduresOpt(); }
+std::string DBProcedureDir() { return DBProcedureDirOpt(); }
+std::string DBQueryPts() { return DBQueryPtsOpt(); }
+std::string DBQueryReach() { return DBQueryReachOpt(); }
+
+void setSVFOption(const std::string& name, const std::string& value)
+{
+    std::string arg = "-" + name + "=" + value;
+    char* argv[] = {const_cast<char*>("svf"), &arg[0]};
+    OptionBase::parseOptions(2, argv, "", "");
+}
+
+static std::vector<std::string>& getTempFiles()
+{
+    static std::vector<std::string> tempFiles;
+    return tempFiles;
+}
+
+std::string createTempFile(const std::string& prefix)
+{
+    const char* dir = getenv("TMPDIR");
+    std::string path = std::string(nullptr != dir && *dir != '\0' ? dir : "/tmp") + "/" + prefix + "-XXXXXX";
+    int fd = mkstemp(&path[0]);
+    if (fd < 0)
+    {
+        SVFUtil::outs() << "Warning: [createTempFile] cannot create " << path << "\n";
+        return "";
+    }
+    close(fd);
+    if (getTempFiles().empty())
+    {
+        std::atexit([]()
+        {
+            for (const std::string& file : getTempFiles())
+                std::remove(file.c_str());
+        });
+    }
+    getTempFiles().push_back(path);
+    return path;
+}
 
 } // namespace SVF
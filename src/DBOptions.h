@@ -5,8 +5,50 @@ namespace SVF {
 
 extern const Option<bool> ReadFromDBOpt;
 extern const Option<bool> Write2DBOpt;
+extern const Option<std::string> Write2DBOfflineOpt;
+extern const Option<bool> Write2DBIncrementalOpt;
+extern const Option<u32_t> DBBatchSizeOpt;
+extern const Option<u32_t> DBPageSizeOpt;
+extern const Option<u32_t> DBThreadsOpt;
+extern const Option<u32_t> DBPrefetchPagesOpt;
+extern const Option<std::string> DBSnapshotOpt;
+extern const Option<std::string> DBEntryOpt;
+extern const Option<bool> ReadPTAFromDBOpt;
+extern const Option<bool> PTAWarmStartOpt;
+extern const Option<bool> ReadSVFGFromDBOpt;
+extern const Option<bool> ReadMTAFromDBOpt;
+extern const Option<bool> Write2DBIndCallsOpt;
+extern const Option<bool> DBProceduresOpt;
+extern const Option<std::string> DBProcedureDirOpt;
+extern const Option<std::string> DBQueryPtsOpt;
+extern const Option<std::string> DBQueryReachOpt;
 
 bool ReadFromDB();
 bool Write2DB();
+std::string Write2DBOfflineDir();
+bool Write2DBIncremental();
+u32_t DBBatchSize();
+u32_t DBPageSize();
+u32_t DBThreads();
+u32_t DBPrefetchPages();
+std::string DBSnapshotFile();
+bool DBLazyLoad();
+std::string DBEntryFunctions();
+bool ReadPTAFromDB();
+bool PTAWarmStart();
+bool ReadSVFGFromDB();
+bool ReadMTAFromDB();
+bool Write2DBIndCalls();
+bool DBProcedures();
+std::string DBProcedureDir();
+std::string DBQueryPts();
+std::string DBQueryReach();
+
+/// set the SVF option name to value as the command line would, SVF reading
+/// its -read-ander and -read-svfg files through options const to the analyses
+void setSVFOption(const std::string& name, const std::string& value);
+/// a new empty file of this run in the temporary directory, removed at exit;
+/// "" if it cannot be created
+std::string createTempFile(const std::string& prefix);
 
 } // namespace SVF
@@ -0,0 +1,203 @@
+#include "DBPageReader.h"
+#include "DBOptions.h"
+#include "DBSnapshot.h"
+
+using namespace SVF;
+
+DBPageReader::DBPageReader(lgraph::RpcClient* connection, const std::string& dbname, const std::string& matchStmt,
+                           const std::string& returnVar, const std::vector<std::string>& keyExprs)
+    : connection(connection), pool(nullptr), dbname(dbname), matchStmt(matchStmt), returnVar(returnVar),
+      keyExprs(keyExprs), hasNextPage(nullptr != connection), prefetchPages(DBPrefetchPages()), fetchDone(false),
+      stopping(false)
+{
+    start();
+}
+
+DBPageReader::DBPageReader(DBConnectionPool* pool, const std::string& dbname, const std::string& matchStmt,
+                           const std::string& returnVar, const std::vector<std::string>& keyExprs)
+    : connection(nullptr), pool(pool), dbname(dbname), matchStmt(matchStmt), returnVar(returnVar),
+      keyExprs(keyExprs), hasNextPage(nullptr != pool && pool->size() > 0), prefetchPages(DBPrefetchPages()),
+      fetchDone(false), stopping(false)
+{
+    start();
+}
+
+DBPageReader::DBPageReader(lgraph::RpcClient* connection, const std::string& dbname, const std::string& matchStmt,
+                           const std::string& pageVar, const std::vector<std::string>& keyExprs,
+                           const std::string& expandStmt, const std::string& returnVar)
+    : connection(connection), pool(nullptr), dbname(dbname), matchStmt(matchStmt), pageVar(pageVar),
+      expandStmt(expandStmt), returnVar(returnVar), keyExprs(keyExprs), hasNextPage(nullptr != connection),
+      prefetchPages(DBPrefetchPages()), fetchDone(false), stopping(false)
+{
+    start();
+}
+
+void DBPageReader::start()
+{
+    if (prefetchPages > 0 && hasNextPage)
+    {
+        fetcher = std::thread(&DBPageReader::run, this);
+    }
+}
+
+DBPageReader::~DBPageReader()
+{
+    if (fetcher.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            stopping = true;
+        }
+        pageTaken.notify_all();
+        fetcher.join();
+    }
+    for (DBResult* page : pages)
+    {
+        delete page;
+    }
+}
+
+DBResult* DBPageReader::next()
+{
+    if (!fetcher.joinable())
+    {
+        return hasNextPage ? fetchPage() : nullptr;
+    }
+    DBResult* page = nullptr;
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        pageReady.wait(lock, [this]() { return !pages.empty() || fetchDone; });
+        if (pages.empty())
+            return nullptr;
+        page = pages.front();
+        pages.pop_front();
+    }
+    pageTaken.notify_one();
+    return page;
+}
+
+void DBPageReader::run()
+{
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            pageTaken.wait(lock, [this]() { return stopping || pages.size() < prefetchPages; });
+            if (stopping)
+                break;
+        }
+        DBResult* page = fetchPage();
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            if (nullptr != page)
+                pages.push_back(page);
+            if (nullptr == page || !hasNextPage)
+                fetchDone = true;
+        }
+        pageReady.notify_one();
+        if (nullptr == page || !hasNextPage)
+            break;
+    }
+    std::lock_guard<std::mutex> lock(mtx);
+    fetchDone = true;
+    pageReady.notify_all();
+}
+
+DBResult* DBPageReader::fetchPage()
+{
+    hasNextPage = false;
+    std::string queryStatement = matchStmt + getKeysetPageStmt(returnVar, keyExprs, lastKeys, pageVar, expandStmt);
+    std::string result;
+    lgraph::RpcClient* conn = nullptr != pool ? pool->acquire() : connection;
+    bool ret = DBSnapshot::query(conn, result, queryStatement, dbname);
+    // the connection is not needed to decode the page
+    if (nullptr != pool)
+        pool->release(conn);
+    if (!ret)
+    {
+        SVFUtil::outs() << queryStatement << "\n";
+        SVFUtil::outs() << "Failed to query from DB:" << result << "\n";
+        return nullptr;
+    }
+    DBResult* root = new DBResult(std::move(result));
+    if (!root->isValid())
+    {
+        SVFUtil::outs() << "Invalid JSON format: " << queryStatement << "\n";
+        delete root;
+        return nullptr;
+    }
+    if (root->size() == 0)
+    {
+        delete root;
+        return nullptr;
+    }
+    hasNextPage = getNextPageKeys(root, keyExprs.size(), lastKeys);
+    return root;
+}
+
+std::string DBPageReader::getKeysetPageStmt(const std::string& returnVar, const std::vector<std::string>& keyExprs,
+                                            const std::vector<std::string>& lastKeys,
+                                            const std::string& pageVar, const std::string& expandStmt)
+{
+    // (k0 > v0) OR (k0 = v0 AND k1 > v1) OR ... so that every page starts
+    // from the index instead of re-scanning the skipped rows
+    std::string whereStr = "";
+    if (lastKeys.size() == keyExprs.size())
+    {
+        for (size_t i = 0; i < keyExprs.size(); ++i)
+        {
+            std::string clause = "";
+            for (size_t j = 0; j < i; ++j)
+            {
+                clause += keyExprs[j] + " = " + lastKeys[j] + " AND ";
+            }
+            clause += keyExprs[i] + " > " + lastKeys[i];
+            whereStr += (whereStr.empty() ? "(" : " OR (") + clause + ")";
+        }
+    }
+    std::string returnStr = returnVar;
+    std::string orderStr = "";
+    for (size_t i = 0; i < keyExprs.size(); ++i)
+    {
+        returnStr += ", " + keyExprs[i] + " AS page_key_" + std::to_string(i);
+        orderStr += (orderStr.empty() ? "" : ", ") + keyExprs[i];
+    }
+    whereStr = whereStr.empty() ? "" : " WHERE " + whereStr;
+    const std::string limitStr = " LIMIT " + std::to_string(DBPageSize());
+    if (!expandStmt.empty())
+    {
+        // the page is cut on the vertices, the rows of its last vertex all
+        // come with it and the next page starts after that vertex
+        return whereStr +
+               " WITH " + pageVar + " ORDER BY " + orderStr + limitStr +
+               " " + expandStmt +
+               " RETURN " + returnStr +
+               " ORDER BY " + orderStr;
+    }
+    return whereStr +
+           " RETURN " + returnStr +
+           " ORDER BY " + orderStr +
+           limitStr;
+}
+
+bool DBPageReader::getNextPageKeys(const DBResult* root, size_t numOfKeys, std::vector<std::string>& lastKeys)
+{
+    u32_t rows = root->size();
+    if (rows == 0)
+        return false;
+    const DBValue* lastRow = root->at(rows - 1);
+    lastKeys.clear();
+    for (size_t i = 0; i < numOfKeys; ++i)
+    {
+        const DBValue* key = lastRow->get(("page_key_" + std::to_string(i)).c_str());
+        if (nullptr == key || !key->isNumber())
+        {
+            SVFUtil::outs() << "Warning: [getNextPageKeys] missing page_key_" << i << " in query result\n";
+            return false;
+        }
+        lastKeys.push_back(std::to_string(static_cast<long long>(key->valuedouble)));
+    }
+    // a short page is the last one, no need to ask for an empty page; the
+    // pages of vertices have at least a row for each vertex
+    return rows >= DBPageSize();
+}
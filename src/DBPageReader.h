@@ -0,0 +1,88 @@
+#ifndef INCLUDE_DBPAGEREADER_H_
+#define INCLUDE_DBPAGEREADER_H_
+#include "DBConnectionPool.h"
+#include "DBResult.h"
+#include "Util/SVFUtil.h"
+#include "lgraph/lgraph_rpc_client.h"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace SVF
+{
+
+/// Read the rows of "<matchStmt> RETURN <returnVar>" page by page with keyset
+/// pagination, ordered on keyExprs.
+/// Unless -db-prefetch-pages=0, a fetch thread requests and decodes the pages
+/// ahead of the caller, keeping up to DBPrefetchPages() decoded pages queued,
+/// so the RPC round trip and the JSON parsing of the next pages overlap with
+/// the construction of the graph from the current one. Each page needs the last
+/// keys of the previous one, so the pages of one reader are fetched one at a time.
+/// The fetch thread is the only user of connection until the reader is destroyed;
+/// a reader built on a pool instead takes a pooled connection for each page, so
+/// that more readers than connections can make progress concurrently.
+/// Edges are read by paging over their source vertices on an indexed key and
+/// expanding the edges of each page, so that no page scans or sorts the edges.
+class DBPageReader
+{
+public:
+    DBPageReader(lgraph::RpcClient* connection, const std::string& dbname, const std::string& matchStmt,
+                 const std::string& returnVar, const std::vector<std::string>& keyExprs);
+    DBPageReader(DBConnectionPool* pool, const std::string& dbname, const std::string& matchStmt,
+                 const std::string& returnVar, const std::vector<std::string>& keyExprs);
+    /// page over the vertices pageVar of matchStmt ordered on keyExprs and return
+    /// returnVar of "<expandStmt>" for those of each page; expandStmt is an
+    /// OPTIONAL MATCH so that every vertex gives a row, returnVar being null
+    /// in the rows of the vertices it does not match
+    DBPageReader(lgraph::RpcClient* connection, const std::string& dbname, const std::string& matchStmt,
+                 const std::string& pageVar, const std::vector<std::string>& keyExprs,
+                 const std::string& expandStmt, const std::string& returnVar);
+    ~DBPageReader();
+
+    DBPageReader(const DBPageReader&) = delete;
+    DBPageReader& operator=(const DBPageReader&) = delete;
+
+    /// the next page, its rows being the elements of the top level array,
+    /// nullptr once every row has been read; the caller deletes it
+    DBResult* next();
+
+    /// the " WHERE ... RETURN ... ORDER BY ... LIMIT" tail of the query reading
+    /// the page right after lastKeys, ordered on keyExprs; with an expandStmt,
+    /// " WHERE ... WITH pageVar ORDER BY ... LIMIT <expandStmt> RETURN ... ORDER BY ..."
+    static std::string getKeysetPageStmt(const std::string& returnVar, const std::vector<std::string>& keyExprs,
+                                         const std::vector<std::string>& lastKeys,
+                                         const std::string& pageVar = "", const std::string& expandStmt = "");
+    /// record the keys of the last row of a page, return false if there is no next page
+    static bool getNextPageKeys(const DBResult* root, size_t numOfKeys, std::vector<std::string>& lastKeys);
+
+private:
+    lgraph::RpcClient* connection;
+    DBConnectionPool* pool;
+    std::string dbname;
+    std::string matchStmt;
+    std::string pageVar;
+    std::string expandStmt;
+    std::string returnVar;
+    std::vector<std::string> keyExprs;
+    std::vector<std::string> lastKeys;
+    bool hasNextPage;
+    u32_t prefetchPages;
+
+    std::thread fetcher;
+    std::deque<DBResult*> pages;
+    bool fetchDone;
+    bool stopping;
+    std::mutex mtx;
+    std::condition_variable pageReady;
+    std::condition_variable pageTaken;
+
+    /// query and decode the page after lastKeys, nullptr if there is none
+    DBResult* fetchPage();
+    void start();
+    void run();
+};
+
+} // namespace SVF
+
+#endif
@@ -0,0 +1,96 @@
+#include "DBParallelWriter.h"
+
+using namespace SVF;
+
+DBParallelWriter::DBParallelWriter(DBConnectionPool* pool, const std::string& dbname,
+                                   u32_t batchSize, u32_t numOfThreads)
+    : DBBatchWriter(nullptr, dbname, batchSize), pool(pool), pendingTasks(0), pendingNodeTasks(0),
+      stopping(false), writtenRows(0)
+{
+    if (numOfThreads == 0)
+        numOfThreads = 1;
+    // two batches per thread are enough to keep every connection busy
+    // while bounding the memory held by serialized batches
+    maxQueuedTasks = 2 * numOfThreads;
+    for (u32_t i = 0; i < numOfThreads; ++i)
+    {
+        workers.emplace_back(&DBParallelWriter::run, this);
+    }
+}
+
+DBParallelWriter::~DBParallelWriter()
+{
+    // flush here, the base destructor can no longer reach writeGroup()
+    flush();
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        stopping = true;
+    }
+    taskQueued.notify_all();
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+u32_t DBParallelWriter::writeGroup(u32_t groupIdx)
+{
+    for (WriteBatch& batch : getWriteBatches(groupIdx))
+    {
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            taskTaken.wait(lock, [this]() { return tasks.size() < maxQueuedTasks; });
+            pendingTasks++;
+            if (!batch.isEdge)
+                pendingNodeTasks++;
+            tasks.push_back(std::move(batch));
+        }
+        taskQueued.notify_one();
+    }
+    return 0;
+}
+
+void DBParallelWriter::waitForNodeWrites()
+{
+    std::unique_lock<std::mutex> lock(mtx);
+    taskDone.wait(lock, [this]() { return pendingNodeTasks == 0; });
+}
+
+void DBParallelWriter::waitForWrites()
+{
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        taskDone.wait(lock, [this]() { return pendingTasks == 0; });
+    }
+    sentRows += writtenRows.exchange(0);
+}
+
+void DBParallelWriter::run()
+{
+    while (true)
+    {
+        WriteBatch task;
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            taskQueued.wait(lock, [this]() { return stopping || !tasks.empty(); });
+            if (tasks.empty())
+                return;
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+        taskTaken.notify_one();
+
+        lgraph::RpcClient* conn = pool->acquire();
+        u32_t written = writeBatch(conn, task);
+        pool->release(conn);
+        writtenRows += written;
+
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            pendingTasks--;
+            if (!task.isEdge)
+                pendingNodeTasks--;
+        }
+        taskDone.notify_all();
+    }
+}
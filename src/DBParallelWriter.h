@@ -0,0 +1,50 @@
+#ifndef INCLUDE_DBPARALLELWRITER_H_
+#define INCLUDE_DBPARALLELWRITER_H_
+#include "DBBatchWriter.h"
+#include "DBConnectionPool.h"
+#include <atomic>
+#include <deque>
+#include <thread>
+
+namespace SVF
+{
+
+/// A DBBatchWriter whose batches are sent by numOfThreads writer threads,
+/// each sending through a connection taken from the pool (-db-threads).
+/// The caller keeps producing rows while the batches are in flight; it only
+/// blocks when the bounded queue is full, and an edge batch is only queued
+/// after every node batch of the graph has been committed.
+class DBParallelWriter : public DBBatchWriter
+{
+public:
+    DBParallelWriter(DBConnectionPool* pool, const std::string& dbname, u32_t batchSize,
+                     u32_t numOfThreads);
+    ~DBParallelWriter() override;
+
+protected:
+    /// queue the batches of groups[groupIdx], the rows are counted once written
+    u32_t writeGroup(u32_t groupIdx) override;
+    void waitForNodeWrites() override;
+    void waitForWrites() override;
+
+private:
+    DBConnectionPool* pool;
+    std::vector<std::thread> workers;
+    std::deque<WriteBatch> tasks;
+    u32_t maxQueuedTasks;
+    /// queued or running tasks
+    u32_t pendingTasks;
+    u32_t pendingNodeTasks;
+    bool stopping;
+    std::atomic<u32_t> writtenRows;
+    std::mutex mtx;
+    std::condition_variable taskQueued;
+    std::condition_variable taskTaken;
+    std::condition_variable taskDone;
+
+    void run();
+};
+
+} // namespace SVF
+
+#endif
@@ -0,0 +1,372 @@
+#include "DBResult.h"
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+
+using namespace SVF;
+
+namespace
+{
+
+/// every layout seen so far, shared by all results (and reader threads)
+std::mutex layoutMtx;
+Map<std::string, std::unique_ptr<DBLayout>> interned;
+
+int hexValue(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
+
+bool parseHex4(const char* str, u32_t& code)
+{
+    code = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        int v = hexValue(str[i]);
+        if (v < 0)
+            return false;
+        code = (code << 4) | static_cast<u32_t>(v);
+    }
+    return true;
+}
+
+/// write code as UTF-8 at out, return the number of bytes written
+int encodeUtf8(u32_t code, char* out)
+{
+    if (code < 0x80)
+    {
+        out[0] = static_cast<char>(code);
+        return 1;
+    }
+    if (code < 0x800)
+    {
+        out[0] = static_cast<char>(0xC0 | (code >> 6));
+        out[1] = static_cast<char>(0x80 | (code & 0x3F));
+        return 2;
+    }
+    if (code < 0x10000)
+    {
+        out[0] = static_cast<char>(0xE0 | (code >> 12));
+        out[1] = static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+        out[2] = static_cast<char>(0x80 | (code & 0x3F));
+        return 3;
+    }
+    out[0] = static_cast<char>(0xF0 | (code >> 18));
+    out[1] = static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+    out[2] = static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+    out[3] = static_cast<char>(0x80 | (code & 0x3F));
+    return 4;
+}
+
+}
+
+int DBLayout::find(const char* name) const
+{
+    for (u32_t i = 0; i < keys.size(); ++i)
+    {
+        if (keys[i] == name)
+            return static_cast<int>(i);
+    }
+    return -1;
+}
+
+const DBValue* DBValue::get(const char* name) const
+{
+    int slot = type == Object && nullptr != layout ? layout->find(name) : -1;
+    return slot >= 0 ? children[slot] : nullptr;
+}
+
+DBResult::DBResult(std::string&& json) : buffer(std::move(json)), valid(false)
+{
+    pos = &buffer[0];
+    limit = pos + buffer.size();
+    // roughly one value per 16 bytes of JSON, saves most reallocations
+    values.reserve(buffer.size() / 16 + 1);
+
+    std::vector<u32_t> stack;
+    if (!parseValue(stack, nullptr))
+    {
+        values.clear();
+        return;
+    }
+    skipWhitespace();
+    if (pos != limit || values[0].type != DBValue::Array)
+    {
+        values.clear();
+        return;
+    }
+
+    // the values are in place now, turn the child offsets into pointers
+    std::vector<const DBValue*> ptrs;
+    ptrs.reserve(childValues.size());
+    for (const DBValue* idx : childValues)
+    {
+        ptrs.push_back(&values[reinterpret_cast<uintptr_t>(idx)]);
+    }
+    childValues.swap(ptrs);
+    for (DBValue& value : values)
+    {
+        value.children = childValues.empty() ? nullptr : childValues.data() + value.childBegin;
+    }
+    valid = true;
+}
+
+void DBResult::skipWhitespace()
+{
+    while (pos != limit && (*pos == ' ' || *pos == '\t' || *pos == '\n' || *pos == '\r'))
+        ++pos;
+}
+
+bool DBResult::parseValue(std::vector<u32_t>& stack, const char* key)
+{
+    skipWhitespace();
+    if (pos == limit)
+        return false;
+
+    u32_t idx = values.size();
+    values.emplace_back();
+    DBValue* value = &values[idx];
+    value->type = DBValue::Null;
+    value->key = key;
+    value->valuestring = nullptr;
+    value->valuedouble = 0;
+    value->valueint = 0;
+    value->numOfChildren = 0;
+    value->childBegin = 0;
+    value->children = nullptr;
+    value->layout = nullptr;
+
+    char c = *pos;
+    if (c == '{' || c == '[')
+    {
+        const bool isObject = c == '{';
+        const char close = isObject ? '}' : ']';
+        ++pos;
+        size_t base = stack.size();
+        std::vector<const char*> keys;
+        skipWhitespace();
+        if (pos != limit && *pos == close)
+        {
+            ++pos;
+        }
+        else
+        {
+            while (true)
+            {
+                char* memberKey = nullptr;
+                if (isObject)
+                {
+                    skipWhitespace();
+                    if (pos == limit || *pos != '"' || !parseString(memberKey))
+                        return false;
+                    skipWhitespace();
+                    if (pos == limit || *pos != ':')
+                        return false;
+                    ++pos;
+                    keys.push_back(memberKey);
+                }
+                if (!parseValue(stack, memberKey))
+                    return false;
+                skipWhitespace();
+                if (pos == limit)
+                    return false;
+                if (*pos == ',')
+                {
+                    ++pos;
+                    continue;
+                }
+                if (*pos != close)
+                    return false;
+                ++pos;
+                break;
+            }
+        }
+        // values may have been reallocated by the members
+        value = &values[idx];
+        value->type = isObject ? DBValue::Object : DBValue::Array;
+        value->numOfChildren = stack.size() - base;
+        value->childBegin = childValues.size();
+        for (size_t i = base; i < stack.size(); ++i)
+        {
+            // offsets for now, turned into pointers once parsing is done
+            childValues.push_back(reinterpret_cast<const DBValue*>(static_cast<uintptr_t>(stack[i])));
+        }
+        stack.resize(base);
+        if (isObject)
+            value->layout = getLayout(keys);
+    }
+    else if (c == '"')
+    {
+        char* str = nullptr;
+        if (!parseString(str))
+            return false;
+        value->type = DBValue::String;
+        value->valuestring = str;
+    }
+    else if (c == 't')
+    {
+        if (!parseLiteral("true", DBValue::True, *value))
+            return false;
+        value->valueint = 1;
+    }
+    else if (c == 'f')
+    {
+        if (!parseLiteral("false", DBValue::False, *value))
+            return false;
+    }
+    else if (c == 'n')
+    {
+        if (!parseLiteral("null", DBValue::Null, *value))
+            return false;
+    }
+    else if (!parseNumber(*value))
+    {
+        return false;
+    }
+    stack.push_back(idx);
+    return true;
+}
+
+bool DBResult::parseString(char*& str)
+{
+    // pos is at the opening quote; the decoded string is never longer than its
+    // escaped form, so it is written over the buffer and terminated in place
+    ++pos;
+    str = pos;
+    char* out = pos;
+    while (pos != limit)
+    {
+        char c = *pos;
+        if (c == '"')
+        {
+            *out = '\0';
+            ++pos;
+            return true;
+        }
+        if (c != '\\')
+        {
+            *out++ = *pos++;
+            continue;
+        }
+        if (limit - pos < 2)
+            return false;
+        char esc = pos[1];
+        pos += 2;
+        switch (esc)
+        {
+        case '"':
+        case '\\':
+        case '/':
+            *out++ = esc;
+            break;
+        case 'b':
+            *out++ = '\b';
+            break;
+        case 'f':
+            *out++ = '\f';
+            break;
+        case 'n':
+            *out++ = '\n';
+            break;
+        case 'r':
+            *out++ = '\r';
+            break;
+        case 't':
+            *out++ = '\t';
+            break;
+        case 'u':
+        {
+            u32_t code = 0;
+            if (limit - pos < 4 || !parseHex4(pos, code))
+                return false;
+            pos += 4;
+            // a surrogate pair encodes one code point in two escapes
+            if (code >= 0xD800 && code <= 0xDBFF && limit - pos >= 6 && pos[0] == '\\' && pos[1] == 'u')
+            {
+                u32_t low = 0;
+                if (parseHex4(pos + 2, low) && low >= 0xDC00 && low <= 0xDFFF)
+                {
+                    code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                    pos += 6;
+                }
+            }
+            out += encodeUtf8(code, out);
+            break;
+        }
+        default:
+            return false;
+        }
+    }
+    return false;
+}
+
+bool DBResult::parseNumber(DBValue& value)
+{
+    if (*pos != '-' && (*pos < '0' || *pos > '9'))
+        return false;
+    char* numEnd = nullptr;
+    double number = std::strtod(pos, &numEnd);
+    if (numEnd == pos || numEnd > limit)
+        return false;
+    pos = numEnd;
+    value.type = DBValue::Number;
+    value.valuedouble = number;
+    if (number >= INT_MAX)
+        value.valueint = INT_MAX;
+    else if (number <= static_cast<double>(INT_MIN))
+        value.valueint = INT_MIN;
+    else
+        value.valueint = static_cast<int>(number);
+    return true;
+}
+
+bool DBResult::parseLiteral(const char* literal, DBValue::Type type, DBValue& value)
+{
+    size_t len = std::strlen(literal);
+    if (static_cast<size_t>(limit - pos) < len || std::strncmp(pos, literal, len) != 0)
+        return false;
+    pos += len;
+    value.type = type;
+    return true;
+}
+
+const DBLayout* DBResult::getLayout(const std::vector<const char*>& keys)
+{
+    // the rows of one page almost always share a handful of layouts
+    for (const DBLayout* layout : localLayouts)
+    {
+        if (layout->keys.size() != keys.size())
+            continue;
+        bool same = true;
+        for (size_t i = 0; i < keys.size() && same; ++i)
+        {
+            same = layout->keys[i] == keys[i];
+        }
+        if (same)
+            return layout;
+    }
+
+    std::string signature;
+    for (const char* key : keys)
+    {
+        signature += key;
+        signature += '\0';
+    }
+    std::lock_guard<std::mutex> lock(layoutMtx);
+    std::unique_ptr<DBLayout>& layout = interned[signature];
+    if (!layout)
+    {
+        layout.reset(new DBLayout());
+        layout->keys.assign(keys.begin(), keys.end());
+    }
+    localLayouts.push_back(layout.get());
+    return layout.get();
+}
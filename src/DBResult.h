@@ -0,0 +1,221 @@
+#ifndef INCLUDE_DBRESULT_H_
+#define INCLUDE_DBRESULT_H_
+#include "Util/SVFUtil.h"
+
+namespace SVF
+{
+
+class DBResult;
+
+/// The member names of an object, shared by every object with the same names
+/// in the same order (e.g. the properties of all nodes of one label).
+/// Layouts are interned for the whole process and never freed, so a slot
+/// resolved for a layout stays valid across pages.
+class DBLayout
+{
+public:
+    std::vector<std::string> keys;
+
+    /// slot of name, -1 if absent
+    int find(const char* name) const;
+};
+
+/// A member name resolved to its slot once per layout instead of on every row.
+/// Declare one per call site with DB_FIELD("name"). Not thread safe: fields are
+/// only resolved by the thread building the graph.
+class DBField
+{
+public:
+    explicit DBField(const char* name) : name(name), layout(nullptr), slot(-1) {}
+
+    inline int getSlot(const DBLayout* l)
+    {
+        if (l != layout)
+        {
+            layout = l;
+            slot = nullptr != l ? l->find(name) : -1;
+        }
+        return slot;
+    }
+
+private:
+    const char* name;
+    const DBLayout* layout;
+    int slot;
+};
+
+/// a DBField local to the call site
+#define DB_FIELD(name) ([]() -> SVF::DBField& { static SVF::DBField field(name); return field; }())
+
+/// One value of a decoded result. Strings point into the result buffer, which
+/// was unescaped and NUL terminated in place, so nothing is copied.
+class DBValue
+{
+    friend class DBResult;
+
+public:
+    enum Type
+    {
+        Null,
+        False,
+        True,
+        Number,
+        String,
+        Array,
+        Object
+    };
+
+    Type type;
+    /// member name within its object, nullptr otherwise
+    const char* key;
+    /// String: the decoded string; nullptr for any other type
+    const char* valuestring;
+    /// Number: its value, valueint saturated to the int range as cJSON does;
+    /// valueint is also 1 for true, again as cJSON
+    double valuedouble;
+    int valueint;
+
+    inline bool isNull() const
+    {
+        return type == Null;
+    }
+    inline bool isTrue() const
+    {
+        return type == True;
+    }
+    inline bool isNumber() const
+    {
+        return type == Number;
+    }
+    inline bool isString() const
+    {
+        return type == String;
+    }
+    inline bool isArray() const
+    {
+        return type == Array;
+    }
+    inline bool isObject() const
+    {
+        return type == Object;
+    }
+
+    /// elements of an array or members of an object
+    inline u32_t size() const
+    {
+        return numOfChildren;
+    }
+    inline const DBValue* const* begin() const
+    {
+        return children;
+    }
+    inline const DBValue* const* end() const
+    {
+        return children + numOfChildren;
+    }
+    inline const DBValue* at(u32_t i) const
+    {
+        return i < numOfChildren ? children[i] : nullptr;
+    }
+
+    /// member of an object, nullptr if absent
+    inline const DBValue* get(DBField& field) const
+    {
+        int slot = type == Object ? field.getSlot(layout) : -1;
+        return slot >= 0 ? children[slot] : nullptr;
+    }
+    const DBValue* get(const char* name) const;
+
+    /// typed members, 0/false/"" if absent (or not a string for getString)
+    inline int getInt(DBField& field) const
+    {
+        const DBValue* v = get(field);
+        return nullptr != v ? v->valueint : 0;
+    }
+    inline double getDouble(DBField& field) const
+    {
+        const DBValue* v = get(field);
+        return nullptr != v ? v->valuedouble : 0;
+    }
+    inline bool getBool(DBField& field) const
+    {
+        const DBValue* v = get(field);
+        return nullptr != v && v->type == True;
+    }
+    inline const char* getString(DBField& field) const
+    {
+        const DBValue* v = get(field);
+        return nullptr != v && v->type == String ? v->valuestring : "";
+    }
+
+private:
+    u32_t numOfChildren;
+    /// offset of the first child in DBResult::childValues while parsing
+    u32_t childBegin;
+    const DBValue* const* children;
+    /// Object: the names of its members, children[i] is the member keys[i]
+    const DBLayout* layout;
+};
+
+/// A query result decoded in place: the buffer returned by the RPC is taken
+/// over, parsed once into a flat array of values without copying any string,
+/// and released with the result. Rows are the elements of the top level array:
+///   for (const DBValue* row : *result) { row->get(DB_FIELD("node")) ... }
+class DBResult
+{
+public:
+    explicit DBResult(std::string&& json);
+
+    DBResult(const DBResult&) = delete;
+    DBResult& operator=(const DBResult&) = delete;
+
+    /// whether the buffer was well formed JSON with an array at the top level
+    inline bool isValid() const
+    {
+        return valid;
+    }
+    inline const DBValue* getRoot() const
+    {
+        return values.empty() ? nullptr : &values[0];
+    }
+
+    inline u32_t size() const
+    {
+        return valid ? values[0].size() : 0;
+    }
+    inline const DBValue* const* begin() const
+    {
+        return valid ? values[0].begin() : nullptr;
+    }
+    inline const DBValue* const* end() const
+    {
+        return valid ? values[0].end() : nullptr;
+    }
+    inline const DBValue* at(u32_t i) const
+    {
+        return valid ? values[0].at(i) : nullptr;
+    }
+
+private:
+    std::string buffer;
+    std::vector<DBValue> values;
+    /// children of all containers, each container owns a contiguous range
+    std::vector<const DBValue*> childValues;
+    /// layouts of this result, looked up before the interned ones
+    std::vector<const DBLayout*> localLayouts;
+    bool valid;
+
+    char* pos;
+    char* limit;
+
+    bool parseValue(std::vector<u32_t>& stack, const char* key);
+    bool parseString(char*& str);
+    bool parseNumber(DBValue& value);
+    bool parseLiteral(const char* literal, DBValue::Type type, DBValue& value);
+    void skipWhitespace();
+    const DBLayout* getLayout(const std::vector<const char*>& keys);
+};
+
+} // namespace SVF
+
+#endif
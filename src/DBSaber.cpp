@@ -0,0 +1,113 @@
+#include "DBSaber.h"
+#include "SABER/ProgSlice.h"
+#include "Graphs/SVFG.h"
+#include <deque>
+
+using namespace SVF;
+
+DBBugReport DBBugReporter::getBugReport(NodeID id, const std::string& kind, const ProgSlice* slice)
+{
+    const SVFGNode* source = slice->getSource();
+    const SVFVar* sourceValue = GraphDBClient::getValueOfSVFGNode(source);
+    DBBugReport report;
+    report.id = id;
+    report.kind = kind;
+    report.sourceICFGNodeId = nullptr != source->getICFGNode() ? static_cast<int>(source->getICFGNode()->getId()) : -1;
+    report.sourcePAGNodeId = nullptr != sourceValue ? static_cast<int>(sourceValue->getId()) : -1;
+    report.sourceLoc = nullptr != source->getICFGNode() ? source->getICFGNode()->getSourceLoc() : "";
+
+    // the sinks in id order, so that the fingerprint does not depend on the hash order
+    OrderedMap<NodeID, const SVFGNode*> sinks;
+    for (const SVFGNode* sink : slice->getSinks())
+    {
+        sinks[sink->getId()] = sink;
+    }
+    // the ids change from build to build, the kind and locations do not
+    std::string fingerprint = kind + "|" + report.sourceLoc;
+    for (const auto& item : sinks)
+    {
+        const SVFGNode* sink = item.second;
+        const SVFVar* sinkValue = GraphDBClient::getValueOfSVFGNode(sink);
+        if (nullptr != sink->getICFGNode())
+        {
+            report.sinkICFGNodeIds.push_back(sink->getICFGNode()->getId());
+            fingerprint += "|" + sink->getICFGNode()->getSourceLoc();
+        }
+        if (nullptr != sinkValue)
+            report.sinkPAGNodeIds.push_back(sinkValue->getId());
+    }
+    report.fingerprint = DBWritePlan::toString(DBWritePlan::hashRow(fingerprint));
+
+    // breadth first in the forward slice, the first sink or dead end found ending the path
+    Map<const SVFGNode*, const SVFGNode*> pred;
+    std::deque<const SVFGNode*> worklist;
+    pred[source] = nullptr;
+    worklist.push_back(source);
+    const SVFGNode* end = nullptr;
+    while (!worklist.empty() && nullptr == end)
+    {
+        const SVFGNode* node = worklist.front();
+        worklist.pop_front();
+        if (node != source && slice->getSinks().find(node) != slice->getSinks().end())
+        {
+            end = node;
+            break;
+        }
+        bool flows = false;
+        for (auto edgeIter = node->OutEdgeBegin(); edgeIter != node->OutEdgeEnd(); ++edgeIter)
+        {
+            const SVFGNode* succ = (*edgeIter)->getDstNode();
+            if (!slice->inForwardSlice(succ))
+                continue;
+            flows = true;
+            if (pred.emplace(succ, node).second)
+                worklist.push_back(succ);
+        }
+        if (!flows && sinks.empty())
+            end = node;
+    }
+    std::vector<const SVFGNode*> path;
+    for (const SVFGNode* node = nullptr != end ? end : source; nullptr != node; node = pred[node])
+    {
+        path.push_back(node);
+    }
+    for (auto it = path.rbegin(); it != path.rend(); ++it)
+    {
+        report.pathSVFGNodeIds.push_back((*it)->getId());
+        const ICFGNode* icfgNode = (*it)->getICFGNode();
+        if (nullptr != icfgNode && (report.pathICFGNodeIds.empty() || report.pathICFGNodeIds.back() != icfgNode->getId()))
+            report.pathICFGNodeIds.push_back(icfgNode->getId());
+    }
+    return report;
+}
+
+void DBBugReporter::printChanges(const DBBugReportResult& previous, const std::vector<DBBugReport>& reports)
+{
+    Set<std::string> previousFingerprints;
+    for (const DBBugReport& report : previous.reports)
+    {
+        previousFingerprints.insert(report.fingerprint);
+    }
+    Set<std::string> fingerprints;
+    u32_t numOfNew = 0;
+    for (const DBBugReport& report : reports)
+    {
+        fingerprints.insert(report.fingerprint);
+        if (previousFingerprints.find(report.fingerprint) == previousFingerprints.end())
+        {
+            SVFUtil::outs() << "New bug: " << report.kind << " at " << report.sourceLoc << "\n";
+            ++numOfNew;
+        }
+    }
+    u32_t numOfGone = 0;
+    for (const DBBugReport& report : previous.reports)
+    {
+        if (fingerprints.find(report.fingerprint) == fingerprints.end())
+        {
+            SVFUtil::outs() << "Gone bug: " << report.kind << " at " << report.sourceLoc << "\n";
+            ++numOfGone;
+        }
+    }
+    SVFUtil::outs() << "Since run " << previous.runId << ": " << numOfNew << " new bugs, " << numOfGone
+                    << " gone, of " << reports.size() << " reported\n";
+}
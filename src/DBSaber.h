@@ -0,0 +1,60 @@
+#ifndef INCLUDE_DBSABER_H_
+#define INCLUDE_DBSABER_H_
+#include "SABER/LeakChecker.h"
+#include "SABER/FileChecker.h"
+#include "SABER/DoubleFreeChecker.h"
+#include "GraphDBClient.h"
+#include <type_traits>
+
+namespace SVF
+{
+
+/// The BugReport rows of the bugs SABER checkers report
+class DBBugReporter
+{
+public:
+    /// the report of the bug found on slice, with the shortest value-flow path
+    /// from its source to a sink, or to where the value stops flowing if no
+    /// sink is reached
+    static DBBugReport getBugReport(NodeID id, const std::string& kind, const ProgSlice* slice);
+    /// print the reports new since the run previous and those gone, matched by fingerprint
+    static void printChanges(const DBBugReportResult& previous, const std::vector<DBBugReport>& reports);
+};
+
+/// Checker (LeakChecker, FileChecker or DoubleFreeChecker) which also keeps
+/// the bugs it reports in reports, for GraphDBClient::insertBugReports2db()
+template <typename Checker>
+class DBSaberChecker : public Checker
+{
+public:
+    DBSaberChecker(std::vector<DBBugReport>& _reports) : reports(_reports) {}
+
+protected:
+    void reportBug(ProgSlice* slice) override
+    {
+        size_t numOfBugs = this->report.getBugSet().size();
+        Checker::reportBug(slice);
+        if (this->report.getBugSet().size() > numOfBugs)
+        {
+            reports.push_back(DBBugReporter::getBugReport(reports.size(), getBugKind(slice), slice));
+        }
+    }
+
+private:
+    /// the GenericBug::BugType the checker reports slice with
+    static std::string getBugKind(const ProgSlice* slice)
+    {
+        if (std::is_base_of<DoubleFreeChecker, Checker>::value)
+            return "DOUBLEFREE";
+        bool isFileChecker = std::is_base_of<FileChecker, Checker>::value;
+        if (!slice->isPartialReachable())
+            return isFileChecker ? "FILENEVERCLOSE" : "NEVERFREE";
+        return isFileChecker ? "FILEPARTIALCLOSE" : "PARTIALLEAK";
+    }
+
+    std::vector<DBBugReport>& reports;
+};
+
+} // namespace SVF
+
+#endif
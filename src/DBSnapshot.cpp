@@ -0,0 +1,229 @@
+#include "DBSnapshot.h"
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+using namespace SVF;
+
+namespace
+{
+
+const char snapshotMagic[] = "SVFDBSNP";
+const size_t snapshotMagicLen = sizeof(snapshotMagic) - 1;
+
+std::atomic<DBSnapshot*> activeSnapshot(nullptr);
+
+template <typename T>
+void writeScalar(std::ofstream& out, T value)
+{
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void writeBytes(std::ofstream& out, const std::string& bytes)
+{
+    out.write(bytes.data(), bytes.size());
+}
+
+/// sequential reads from the loaded file, failing once past its end
+class SnapshotCursor
+{
+public:
+    SnapshotCursor(const std::string& data) : data(data), pos(0) {}
+
+    template <typename T>
+    bool read(T& value)
+    {
+        if (data.size() - pos < sizeof(T))
+            return false;
+        std::memcpy(&value, data.data() + pos, sizeof(T));
+        pos += sizeof(T);
+        return true;
+    }
+    /// skip len bytes, returning where they start
+    bool skip(size_t len, size_t& start)
+    {
+        if (data.size() - pos < len)
+            return false;
+        start = pos;
+        pos += len;
+        return true;
+    }
+
+private:
+    const std::string& data;
+    size_t pos;
+};
+
+}
+
+DBSnapshot::DBSnapshot(const std::string& path, const GraphStamps& stamps)
+    : path(path), stamps(stamps), replaying(false)
+{
+    replaying = load();
+    if (replaying)
+    {
+        SVFUtil::outs() << "Reading graphs from DB snapshot " << path << "\n";
+    }
+    else
+    {
+        data.clear();
+        key2Range.clear();
+    }
+}
+
+bool DBSnapshot::load()
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in.is_open())
+        return false;
+    in.seekg(0, std::ios::end);
+    std::streamoff size = in.tellg();
+    if (size <= 0)
+        return false;
+    data.resize(static_cast<size_t>(size));
+    in.seekg(0, std::ios::beg);
+    if (!in.read(&data[0], size))
+        return false;
+
+    SnapshotCursor cursor(data);
+    size_t start = 0;
+    if (!cursor.skip(snapshotMagicLen, start) || data.compare(start, snapshotMagicLen, snapshotMagic) != 0)
+        return false;
+    u32_t version = 0;
+    u32_t numOfGraphs = 0;
+    if (!cursor.read(version) || version != formatVersion || !cursor.read(numOfGraphs) ||
+        numOfGraphs != stamps.size())
+        return false;
+    // the snapshot is only valid for graphs at exactly the same stamps
+    for (const auto& graphStamp : stamps)
+    {
+        u32_t len = 0;
+        s64_t stamp = 0;
+        if (!cursor.read(len) || !cursor.skip(len, start) ||
+            data.compare(start, len, graphStamp.first) != 0 || !cursor.read(stamp) ||
+            stamp != graphStamp.second)
+        {
+            SVFUtil::outs() << "DB snapshot " << path << " is out of date, taking a new one\n";
+            return false;
+        }
+    }
+    u32_t numOfEntries = 0;
+    if (!cursor.read(numOfEntries))
+        return false;
+    for (u32_t i = 0; i < numOfEntries; ++i)
+    {
+        u32_t keyLen = 0;
+        u64_t resultLen = 0;
+        size_t keyStart = 0;
+        size_t resultStart = 0;
+        if (!cursor.read(keyLen) || !cursor.skip(keyLen, keyStart) || !cursor.read(resultLen) ||
+            !cursor.skip(resultLen, resultStart))
+        {
+            SVFUtil::outs() << "Warning: [DBSnapshot] Truncated snapshot " << path << "\n";
+            return false;
+        }
+        key2Range[data.substr(keyStart, keyLen)] = std::make_pair(resultStart, resultLen);
+    }
+    return true;
+}
+
+bool DBSnapshot::lookup(const std::string& dbname, const std::string& stmt, std::string& result) const
+{
+    if (!replaying)
+        return false;
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = key2Range.find(getKey(dbname, stmt));
+    if (it == key2Range.end())
+        return false;
+    result.assign(data, it->second.first, it->second.second);
+    return true;
+}
+
+void DBSnapshot::record(const std::string& dbname, const std::string& stmt, const std::string& result)
+{
+    if (replaying)
+        return;
+    std::lock_guard<std::mutex> lock(mtx);
+    entries.emplace_back(getKey(dbname, stmt), result);
+}
+
+bool DBSnapshot::save() const
+{
+    if (replaying)
+        return true;
+    std::lock_guard<std::mutex> lock(mtx);
+    std::string tmpPath = path + ".tmp";
+    {
+        std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+        if (!out.is_open())
+        {
+            SVFUtil::outs() << "Warning: [DBSnapshot] Failed to write " << tmpPath << "\n";
+            return false;
+        }
+        out.write(snapshotMagic, snapshotMagicLen);
+        writeScalar<u32_t>(out, formatVersion);
+        writeScalar<u32_t>(out, stamps.size());
+        for (const auto& graphStamp : stamps)
+        {
+            writeScalar<u32_t>(out, graphStamp.first.size());
+            writeBytes(out, graphStamp.first);
+            writeScalar<s64_t>(out, graphStamp.second);
+        }
+        writeScalar<u32_t>(out, entries.size());
+        for (const auto& entry : entries)
+        {
+            writeScalar<u32_t>(out, entry.first.size());
+            writeBytes(out, entry.first);
+            writeScalar<u64_t>(out, entry.second.size());
+            writeBytes(out, entry.second);
+        }
+        if (!out.good())
+        {
+            SVFUtil::outs() << "Warning: [DBSnapshot] Failed to write " << tmpPath << "\n";
+            return false;
+        }
+    }
+    // a reader never sees a half written snapshot
+    std::error_code ec;
+    std::filesystem::rename(tmpPath, path, ec);
+    if (ec)
+    {
+        SVFUtil::outs() << "Warning: [DBSnapshot] Failed to replace " << path << ": " << ec.message() << "\n";
+        return false;
+    }
+    SVFUtil::outs() << "DB snapshot of " << entries.size() << " queries written to " << path << "\n";
+    return true;
+}
+
+DBSnapshot* DBSnapshot::getActive()
+{
+    return activeSnapshot.load();
+}
+
+void DBSnapshot::setActive(DBSnapshot* snapshot)
+{
+    activeSnapshot.store(snapshot);
+}
+
+bool DBSnapshot::query(lgraph::RpcClient* connection, std::string& result, const std::string& stmt,
+                       const std::string& dbname)
+{
+    DBSnapshot* snapshot = getActive();
+    if (nullptr != snapshot && snapshot->lookup(dbname, stmt, result))
+        return true;
+    if (nullptr == connection || !connection->CallCypher(result, stmt, dbname))
+        return false;
+    if (nullptr != snapshot)
+        snapshot->record(dbname, stmt, result);
+    return true;
+}
+
+void DBSnapshot::invalidate(const std::string& path)
+{
+    std::error_code ec;
+    if (std::filesystem::remove(path, ec))
+    {
+        SVFUtil::outs() << "DB snapshot " << path << " invalidated\n";
+    }
+}
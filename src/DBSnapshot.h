@@ -0,0 +1,76 @@
+#ifndef INCLUDE_DBSNAPSHOT_H_
+#define INCLUDE_DBSNAPSHOT_H_
+#include "Util/SVFUtil.h"
+#include "lgraph/lgraph_rpc_client.h"
+#include <mutex>
+
+namespace SVF
+{
+
+/// A local binary copy of the query results of a -read-from-db run
+/// (-db-snapshot=<file>).
+/// Every graph written by GraphDBClient carries a DBVersion vertex whose stamp
+/// changes each time the graph is rewritten. A snapshot taken at the stamps the
+/// graphs have now answers every read query from the file, so the SVFIR is
+/// rebuilt without any server round trip; otherwise the results of this run
+/// are recorded and saved for the next one.
+/// File layout (native byte order, the file is a local cache):
+///   "SVFDBSNP" u32:formatVersion u32:numOfGraphs {u32:len name s64:stamp}*
+///   u32:numOfEntries {u32:len key u64:len result}*
+class DBSnapshot
+{
+public:
+    typedef std::vector<std::pair<std::string, s64_t>> GraphStamps;
+
+    static constexpr u32_t formatVersion = 1;
+
+    /// load path if it was taken at stamps, or prepare to record a new one
+    DBSnapshot(const std::string& path, const GraphStamps& stamps);
+
+    DBSnapshot(const DBSnapshot&) = delete;
+    DBSnapshot& operator=(const DBSnapshot&) = delete;
+
+    /// whether the queries are answered from the file
+    inline bool isReplaying() const
+    {
+        return replaying;
+    }
+
+    /// the result of stmt on dbname from the file, false if it was not recorded
+    bool lookup(const std::string& dbname, const std::string& stmt, std::string& result) const;
+    /// keep the result of stmt on dbname for save()
+    void record(const std::string& dbname, const std::string& stmt, const std::string& result);
+    /// write the recorded results, replacing the file once it is complete
+    bool save() const;
+
+    /// the snapshot answering the read queries, nullptr if none
+    static DBSnapshot* getActive();
+    static void setActive(DBSnapshot* snapshot);
+    /// run a read query through the active snapshot: answered from the file when
+    /// replaying, else sent through connection and recorded
+    static bool query(lgraph::RpcClient* connection, std::string& result, const std::string& stmt,
+                      const std::string& dbname);
+    /// delete the snapshot at path, the graphs it was taken from are rewritten
+    static void invalidate(const std::string& path);
+
+private:
+    std::string path;
+    GraphStamps stamps;
+    bool replaying;
+    /// replaying: the file contents and the range of each result in it
+    std::string data;
+    Map<std::string, std::pair<size_t, size_t>> key2Range;
+    /// recording: the results in the order they were received
+    std::vector<std::pair<std::string, std::string>> entries;
+    mutable std::mutex mtx;
+
+    static inline std::string getKey(const std::string& dbname, const std::string& stmt)
+    {
+        return dbname + "\n" + stmt;
+    }
+    bool load();
+};
+
+} // namespace SVF
+
+#endif
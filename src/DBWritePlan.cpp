@@ -0,0 +1,95 @@
+#include "DBWritePlan.h"
+
+using namespace SVF;
+
+u64_t DBWritePlan::hashRow(const std::string& stmt)
+{
+    // FNV-1a, then mixed so that the sums of similar rows stay apart
+    u64_t hash = 14695981039346656037ULL;
+    for (char c : stmt)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ULL;
+    }
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+std::string DBWritePlan::toString(u64_t hash)
+{
+    static const char hexDigits[] = "0123456789abcdef";
+    std::string str(16, '0');
+    for (int i = 15; i >= 0; --i)
+    {
+        str[i] = hexDigits[hash & 15];
+        hash >>= 4;
+    }
+    return str;
+}
+
+void DBWritePlan::addFunctionRow(const std::string& funName, const std::string& stmt)
+{
+    // a sum does not depend on the order the rows are visited in
+    funHashes[funName] += hashRow(stmt);
+}
+
+void DBWritePlan::addGraphRow(const std::string& graph, const std::string& stmt)
+{
+    graphHashes[graph] += hashRow(stmt);
+}
+
+void DBWritePlan::addStoredFunction(const std::string& funName, NodeID funObjVarId, const std::string& hash)
+{
+    storedFunHashes[funName] = hash;
+    storedFunIds[funName].push_back(funObjVarId);
+}
+
+void DBWritePlan::setStoredGraphHash(const std::string& graph, const std::string& hash)
+{
+    storedGraphHashes[graph] = hash;
+}
+
+std::string DBWritePlan::getFunctionHash(const std::string& funName) const
+{
+    auto it = funHashes.find(funName);
+    return toString(it != funHashes.end() ? it->second : 0);
+}
+
+std::string DBWritePlan::getGraphHash(const std::string& graph) const
+{
+    auto it = graphHashes.find(graph);
+    return toString(it != graphHashes.end() ? it->second : 0);
+}
+
+void DBWritePlan::compare()
+{
+    patchedGraphs.clear();
+    rewrittenFuns.clear();
+    staleFunIds.clear();
+    for (const auto& item : storedGraphHashes)
+    {
+        if (!item.second.empty() && item.second == getGraphHash(item.first))
+        {
+            patchedGraphs.insert(item.first);
+        }
+    }
+    for (const auto& item : funHashes)
+    {
+        auto stored = storedFunHashes.find(item.first);
+        if (stored == storedFunHashes.end() || stored->second != toString(item.second))
+        {
+            rewrittenFuns.insert(item.first);
+        }
+    }
+    // the rows of the previous write of the rewritten functions and of
+    // the functions which are gone
+    for (const auto& item : storedFunIds)
+    {
+        if (isRewritten(item.first) || funHashes.find(item.first) == funHashes.end())
+        {
+            staleFunIds.insert(staleFunIds.end(), item.second.begin(), item.second.end());
+        }
+    }
+}
@@ -0,0 +1,95 @@
+#ifndef INCLUDE_DBWRITEPLAN_H_
+#define INCLUDE_DBWRITEPLAN_H_
+#include "Util/SVFUtil.h"
+
+namespace SVF
+{
+
+/// What -write2db-incremental writes. The insert statements of the rows are
+/// summed into content hashes: one per function for the rows belonging to it
+/// (its blocks, ICFG nodes and their edges, the stmts of those nodes, its
+/// CallGraph node and edges) and one per graph for all the other rows.
+/// Compared with the hashes stored by the previous write, they tell which
+/// graphs are written again as a whole and, in the other (patched) graphs,
+/// which functions have their rows deleted and inserted again.
+/// Functions are matched by name, their ids being those of the previous write.
+class DBWritePlan
+{
+public:
+    /// hash of one row, summed into the hash of its function or graph
+    static u64_t hashRow(const std::string& stmt);
+    /// the stored form of a hash, 16 hex digits
+    static std::string toString(u64_t hash);
+
+    /// the hashes of the program about to be written
+    void addFunctionRow(const std::string& funName, const std::string& stmt);
+    void addGraphRow(const std::string& graph, const std::string& stmt);
+
+    /// the hashes stored in DB by the previous write ("" if none)
+    void addStoredFunction(const std::string& funName, NodeID funObjVarId, const std::string& hash);
+    void setStoredGraphHash(const std::string& graph, const std::string& hash);
+
+    /// compare the two once both are complete
+    void compare();
+
+    /// whether graph keeps its rows in DB, only those of the rewritten functions being replaced
+    inline bool isPatched(const std::string& graph) const
+    {
+        return patchedGraphs.find(graph) != patchedGraphs.end();
+    }
+    /// whether the rows of the function are (re)written
+    inline bool isRewritten(const std::string& funName) const
+    {
+        return rewrittenFuns.find(funName) != rewrittenFuns.end();
+    }
+    /// whether anything is to be written into graph
+    inline bool needsWrite(const std::string& graph) const
+    {
+        return !isPatched(graph) || !rewrittenFuns.empty() || !staleFunIds.empty();
+    }
+    /// ids of the previous write of the functions whose rows are deleted
+    inline const std::vector<NodeID>& getStaleFunIds() const
+    {
+        return staleFunIds;
+    }
+    /// edge ids of the previous write of the stmts of the ICFG nodes of those functions
+    inline const std::vector<NodeID>& getStaleStmtIds() const
+    {
+        return staleStmtIds;
+    }
+    inline void addStaleStmtId(NodeID id)
+    {
+        staleStmtIds.push_back(id);
+    }
+    inline u32_t getNumOfFunctions() const
+    {
+        return funHashes.size();
+    }
+    inline u32_t getNumOfRewrittenFunctions() const
+    {
+        return rewrittenFuns.size();
+    }
+
+    inline const Map<std::string, u64_t>& getFunctionHashes() const
+    {
+        return funHashes;
+    }
+    std::string getFunctionHash(const std::string& funName) const;
+    std::string getGraphHash(const std::string& graph) const;
+
+private:
+    Map<std::string, u64_t> funHashes;
+    Map<std::string, u64_t> graphHashes;
+    Map<std::string, std::string> storedFunHashes;
+    Map<std::string, std::vector<NodeID>> storedFunIds;
+    Map<std::string, std::string> storedGraphHashes;
+
+    Set<std::string> patchedGraphs;
+    Set<std::string> rewrittenFuns;
+    std::vector<NodeID> staleFunIds;
+    std::vector<NodeID> staleStmtIds;
+};
+
+} // namespace SVF
+
+#endif
@@ -0,0 +1,28 @@
+#include "DBWriteStat.h"
+#include "DBOptions.h"
+
+using namespace SVF;
+
+std::chrono::steady_clock::time_point DBWriteStat::startGraph(const std::string& graph)
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    SVFUtil::outs() << "Writing " << graph << " to DB ...\n";
+    return std::chrono::steady_clock::now();
+}
+
+void DBWriteStat::endGraph(const std::string& graph, std::chrono::steady_clock::time_point graphStart)
+{
+    double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - graphStart).count();
+    std::lock_guard<std::mutex> lock(mtx);
+    timeStatMap[graph + "WriteTime"] = time;
+    SVFUtil::outs() << "Writing " << graph << " to DB done (" << time << "s)\n";
+}
+
+void DBWriteStat::performStat()
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    timeStatMap["TotalWriteTime"] = std::chrono::duration<double>(std::chrono::steady_clock::now() - writeStart).count();
+    generalNumMap["WrittenGraphs"] = timeStatMap.size() - 1;
+    generalNumMap["WriteThreads"] = DBThreads();
+    SVFStat::printStat("DB Write");
+}
@@ -0,0 +1,32 @@
+#ifndef INCLUDE_DBWRITESTAT_H_
+#define INCLUDE_DBWRITESTAT_H_
+#include "Util/SVFStat.h"
+#include <chrono>
+#include <mutex>
+
+namespace SVF
+{
+
+/// Wall-clock time spent writing each graph to the DB (-write2db / -write2db-offline).
+/// The graphs are written by concurrent tasks, which report here when they finish.
+/// It is measured with steady_clock, the CPU time of SVFStat would add up the tasks.
+class DBWriteStat : public SVFStat
+{
+public:
+    DBWriteStat() : writeStart(std::chrono::steady_clock::now()) {}
+    ~DBWriteStat() override = default;
+
+    /// the task writing graph started/finished, thread safe
+    std::chrono::steady_clock::time_point startGraph(const std::string& graph);
+    void endGraph(const std::string& graph, std::chrono::steady_clock::time_point graphStart);
+
+    void performStat() override;
+
+private:
+    std::mutex mtx;
+    std::chrono::steady_clock::time_point writeStart;
+};
+
+} // namespace SVF
+
+#endif
@@ -1,18 +1,53 @@
 #include "GraphDBClient.h"
+#include "DBBatchWriter.h"
+#include "DBOfflineWriter.h"
+#include "DBPageReader.h"
+#include "DBParallelWriter.h"
+#include "DBSnapshot.h"
+#include "DBOptions.h"
 #include "SVFIR/SVFVariables.h"
+#include "MemoryModel/PointerAnalysisImpl.h"
+#include "Graphs/SVFG.h"
+#include "MTA/MHP.h"
+#include "MTA/LockAnalysis.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <climits>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <unistd.h>
 
 using namespace SVF;
 
-Map<int,FunObjVar*> id2funObjVarsMap;
-Set<SVFBasicBlock*> basicBlocks;
-Map<int, RetICFGNode*> id2RetICFGNodeMap;
-Map<int, CallPE*> id2CallPEMap;
-Map<int, RetPE*> id2RetPEMap;
-Map<CallCFGEdge*, std::string> callCFGEdge2CallPEStrMap;
-Map<RetCFGEdge*, int> retCFGEdge2RetPEStrMap;
-Map<ICFGNode*, std::string> icfgNode2StmtsStrMap;
-Map<int, SVFStmt*> edgeId2SVFStmtMap;
-Map<SVFBasicBlock*, std::string> bb2AllICFGNodeIdstrMap;
+/// PAG node labels, in the order their vars are created when reading from DB
+static const std::vector<std::string> pagNodeTypes = {
+    "ValVar", "ObjVar", "ArgValVar", "GepValVar", "BaseObjVar", "GepObjVar", "HeapObjVar",
+    "StackObjVar", "FunObjVar", "FunValVar", "GlobalValVar", "ConstAggValVar", "ConstDataValVar",
+    "BlackHoleValVar", "ConstFPValVar", "ConstIntValVar", "ConstNullPtrValVar", "GlobalObjVar",
+    "ConstAggObjVar", "ConstDataObjVar", "ConstFPObjVar", "ConstIntObjVar", "ConstNullPtrObjVar",
+    "RetValPN", "VarArgValPN", "DummyValVar", "DummyObjVar"};
+/// PAG edge labels, in the order their stmts are created when reading from DB
+static const std::vector<std::string> pagEdgeTypes = {
+    "AddrStmt", "CopyStmt", "StoreStmt", "LoadStmt", "GepStmt", "CallPE", "RetPE", "PhiStmt",
+    "SelectStmt", "CmpStmt", "BinaryOPStmt", "UnaryOPStmt", "BranchStmt", "TDForkPE", "RetPETDJoinPE"};
+
+/// ICFG node labels of a function, in the order they are read: a CallICFGNode needs its RetICFGNode
+static const std::vector<std::string> funICFGNodeTypes = {
+    "FunEntryICFGNode", "FunExitICFGNode", "IntraICFGNode", "RetICFGNode", "CallICFGNode"};
+static const std::vector<std::string> icfgEdgeTypes = {"IntraCFGEdge", "CallCFGEdge", "RetCFGEdge"};
+/// ICFG node labels each ICFG edge label leaves, the edges are read by paging over their source nodes
+static const Map<std::string, std::vector<std::string>> icfgEdgeSrcTypes = {
+    {"IntraCFGEdge", {"GlobalICFGNode", "FunEntryICFGNode", "IntraICFGNode", "RetICFGNode", "CallICFGNode"}},
+    {"CallCFGEdge", {"CallICFGNode"}},
+    {"RetCFGEdge", {"FunExitICFGNode"}}};
+/// ICFG edges from a node outside a function into it: edge, source and destination labels
+static const std::vector<std::array<std::string, 3>> interFunICFGEdgeTypes = {
+    {"IntraCFGEdge", "GlobalICFGNode", "FunEntryICFGNode"},
+    {"CallCFGEdge", "CallICFGNode", "FunEntryICFGNode"},
+    {"RetCFGEdge", "FunExitICFGNode", "RetICFGNode"}};
 
 bool GraphDBClient::loadSchema(lgraph::RpcClient* connection,
                                const std::string& filepath,
@@ -50,30 +85,1438 @@ bool GraphDBClient::createSubGraph(lgraph::RpcClient* connection, const std::str
     return false;
 }
 
-bool GraphDBClient::addICFGEdge2db(lgraph::RpcClient* connection,
-                                   const ICFGEdge* edge,
-                                   const std::string& dbname)
+DBBatchWriter* GraphDBClient::createGraphWriter(const std::string& graphname,
+                                                const std::vector<std::string>& schemaFiles)
+{
+    // the graph is about to change, so is every snapshot taken from it
+    if (!DBSnapshotFile().empty())
+    {
+        DBSnapshot::invalidate(DBSnapshotFile());
+    }
+    std::vector<std::string> graphSchemaFiles = schemaFiles;
+    graphSchemaFiles.push_back(std::string(WORKSPACE_DIR) + "/src/DBSchema/DBVersionSchema.json");
+
+    const bool patched = isGraphPatched(graphname);
+    DBBatchWriter* writer = nullptr;
+    if (isOfflineMode())
+    {
+        writer = new DBOfflineWriter(Write2DBOfflineDir(), graphname, graphSchemaFiles, DBBatchSize());
+    }
+    else if (DBThreads() > 1)
+    {
+        // graphs may be written concurrently, so their schema is set up
+        // on a pooled connection rather than the shared main one
+        DBConnectionPool* pool = getConnectionPool();
+        lgraph::RpcClient* schemaConnection = pool->acquire();
+        if (patched)
+        {
+            patchSubGraph(schemaConnection, graphname);
+        }
+        else
+        {
+            createSubGraph(schemaConnection, graphname);
+            for (const std::string& schemaFile : graphSchemaFiles)
+            {
+                loadSchema(schemaConnection, schemaFile, graphname);
+            }
+        }
+        const bool byVid = loadProcedure(schemaConnection, "svf_add_edges", graphname, false);
+        pool->release(schemaConnection);
+        writer = new DBParallelWriter(pool, graphname, DBBatchSize(), DBThreads());
+        if (byVid)
+            writer->setEdgeProcedure("svf_add_edges");
+    }
+    else
+    {
+        if (patched)
+        {
+            patchSubGraph(connection, graphname);
+        }
+        else
+        {
+            createSubGraph(connection, graphname);
+            for (const std::string& schemaFile : graphSchemaFiles)
+            {
+                loadSchema(connection, schemaFile, graphname);
+            }
+        }
+        writer = new DBBatchWriter(connection, graphname, DBBatchSize());
+        if (loadProcedure(connection, "svf_add_edges", graphname, false))
+            writer->setEdgeProcedure("svf_add_edges");
+    }
+    // a new stamp for every rewrite of the graph (see DBSnapshot)
+    s64_t stamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::system_clock::now().time_since_epoch()).count();
+    {
+        std::lock_guard<std::mutex> lock(writtenStampsMtx);
+        writtenStamps[graphname] = stamp;
+    }
+    if (patched)
+    {
+        // the rows of no function, hashed by content_hash, are those kept
+        writer->addStmt("MATCH (n:DBVersion) SET n.stamp = " + std::to_string(stamp));
+    }
+    else
+    {
+        std::string contentHash = nullptr != writePlan ? ", content_hash:'" + writePlan->getGraphHash(graphname) + "'" : "";
+        writer->addNodeStmt("CREATE (n:DBVersion {id:0, stamp:" + std::to_string(stamp) + contentHash + "})");
+    }
+    return writer;
+}
+
+bool GraphDBClient::patchSubGraph(lgraph::RpcClient* connection, const std::string& graphname)
+{
+    if (nullptr == connection || nullptr == writePlan)
+    {
+        return false;
+    }
+    // the vertices go with their edges, the edges from the functions kept are
+    // inserted again along with the rows of the rewritten ones. Every MATCH
+    // names its label so that only the vertices/edges of that label are looked at.
+    std::vector<std::string> deleteStmts;
+    const std::vector<NodeID>* ids = &writePlan->getStaleFunIds();
+    if (graphname == "BasicBlockGraph")
+    {
+        deleteStmts.push_back("MATCH (n:SVFBasicBlock) WHERE n.fun_obj_var_id IN [%] DETACH DELETE n");
+    }
+    else if (graphname == "ICFG")
+    {
+        for (const std::string& nodeType : funICFGNodeTypes)
+            deleteStmts.push_back("MATCH (n:" + nodeType + ") WHERE n.fun_obj_var_id IN [%] DETACH DELETE n");
+    }
+    else if (graphname == "CallGraph")
+    {
+        deleteStmts.push_back("MATCH (n:CallGraphNode) WHERE n.fun_obj_var_id IN [%] DETACH DELETE n");
+    }
+    else if (graphname == "PAG")
+    {
+        // the PAG nodes belong to no function, only the stmts of the ICFG nodes
+        // go, found by their indexed edge_id as when they are loaded lazily
+        for (const std::string& edgeType : pagEdgeTypes)
+            deleteStmts.push_back("MATCH ()-[e:" + edgeType + "]->() WHERE e.edge_id IN [%] DELETE e");
+        ids = &writePlan->getStaleStmtIds();
+    }
+    else
+    {
+        return true;
+    }
+    const size_t idsPerStmt = std::max(DBBatchSize(), 1u);
+    bool ret = true;
+    for (size_t begin = 0; begin < ids->size(); begin += idsPerStmt)
+    {
+        std::string idList = "";
+        for (size_t i = begin; i < std::min(ids->size(), begin + idsPerStmt); ++i)
+        {
+            idList += (idList.empty() ? "" : ", ") + std::to_string((*ids)[i]);
+        }
+        for (const std::string& deleteStmt : deleteStmts)
+        {
+            const size_t pos = deleteStmt.find('%');
+            std::string result;
+            if (!connection->CallCypher(result, deleteStmt.substr(0, pos) + idList + deleteStmt.substr(pos + 1), graphname))
+            {
+                SVFUtil::outs() << "Warining: Failed to delete the rows of the rewritten functions from "
+                                << graphname << " " << result << "\n";
+                ret = false;
+            }
+        }
+    }
+    return ret;
+}
+
+s64_t GraphDBClient::readVersionStamp(lgraph::RpcClient* connection, const std::string& graphname)
+{
+    std::string result;
+    // asked of the server itself, never of the snapshot being validated
+    if (nullptr == connection || !connection->CallCypher(result, "MATCH (n:DBVersion) RETURN n.stamp", graphname))
+        return -1;
+    DBResult root(std::move(result));
+    const DBValue* row = root.at(0);
+    const DBValue* stamp = nullptr != row ? row->get(DB_FIELD("n.stamp")) : nullptr;
+    return nullptr != stamp && stamp->isNumber() ? static_cast<s64_t>(stamp->valuedouble) : -1;
+}
+
+/// the function the row of stmt belongs to under -write2db-incremental, that of its ICFG node
+static inline const FunObjVar* getFunOfRow(const SVFStmt* stmt)
+{
+    return nullptr != stmt->getICFGNode() ? stmt->getICFGNode()->getFun() : nullptr;
+}
+
+/// an ICFG edge belongs to the function of its source, else of its destination
+static inline const FunObjVar* getFunOfRow(const ICFGEdge* edge)
+{
+    const FunObjVar* fun = edge->getSrcNode()->getFun();
+    return nullptr != fun ? fun : edge->getDstNode()->getFun();
+}
+
+void GraphDBClient::planIncrementalWrite(SVFIR* pag, const CHGraph* chg)
+{
+    delete writePlan;
+    writePlan = nullptr;
+    if (isOfflineMode())
+    {
+        SVFUtil::outs() << "Warning: [planIncrementalWrite] -write2db-incremental needs the server, the import files get every row\n";
+        return;
+    }
+    if (nullptr == connection)
+    {
+        return;
+    }
+    DBWritePlan* plan = new DBWritePlan();
+    auto addRow = [plan](const std::string& graph, const FunObjVar* fun, const std::string& stmt)
+    {
+        if (nullptr != fun)
+            plan->addFunctionRow(fun->getName(), stmt);
+        else
+            plan->addGraphRow(graph, stmt);
+    };
+
+    // the rows insert*2db() write, with the same statements
+    for (const SVFType* ty : pag->getSVFTypes())
+    {
+        plan->addGraphRow("SVFType", getSVFTypeInsertStmt(ty));
+    }
+    for (const StInfo* stInfo : pag->getStInfos())
+    {
+        plan->addGraphRow("SVFType", stInfo2DBString(stInfo));
+    }
+    for (auto it = pag->begin(); it != pag->end(); ++it)
+    {
+        const SVFVar* node = it->second;
+        plan->addGraphRow("PAG", getPAGNodeInsertStmt(node));
+        if (const FunObjVar* funObjVar = SVFUtil::dyn_cast<FunObjVar>(node))
+        {
+            if (nullptr != funObjVar->getBasicBlockGraph())
+            {
+                for (auto& bb : *funObjVar->getBasicBlockGraph())
+                {
+                    addRow("BasicBlockGraph", funObjVar, bb2DBString(bb.second));
+                    for (auto iter = bb.second->OutEdgeBegin(); iter != bb.second->OutEdgeEnd(); ++iter)
+                    {
+                        addRow("BasicBlockGraph", funObjVar, bbEdge2DBString(*iter));
+                    }
+                }
+            }
+        }
+        for (auto edgeIter = node->OutEdgeBegin(); edgeIter != node->OutEdgeEnd(); ++edgeIter)
+        {
+            addRow("PAG", getFunOfRow(*edgeIter), getPAGEdgeInsertStmt(*edgeIter));
+        }
+    }
+    for (auto it = pag->getICFG()->begin(); it != pag->getICFG()->end(); ++it)
+    {
+        const ICFGNode* node = it->second;
+        addRow("ICFG", node->getFun(), getICFGNodeInsertStmt(node));
+        for (auto edgeIter = node->OutEdgeBegin(); edgeIter != node->OutEdgeEnd(); ++edgeIter)
+        {
+            addRow("ICFG", getFunOfRow(*edgeIter), getICFGEdgeInsertStmt(*edgeIter));
+        }
+    }
+    for (auto it = chg->begin(); it != chg->end(); ++it)
+    {
+        plan->addGraphRow("CHG", getCHNodeInsertStmt(it->second));
+        for (auto edgeIter = it->second->OutEdgeBegin(); edgeIter != it->second->OutEdgeEnd(); ++edgeIter)
+        {
+            plan->addGraphRow("CHG", getCHEdgeInsertStmt(*edgeIter));
+        }
+    }
+    // the fields insertCHG2db() sets on the call nodes are rows of their function
+    for (const auto& pair : chg->callNodeToClassesMap)
+    {
+        std::string chNodes = extractNodesIds(pair.second);
+        if (chNodes.size() > 0)
+            addRow("ICFG", pair.first->getFun(), getCHNodes2ICFGNodeUpdateStmt(pair.first->getId(), chNodes, "chnodes_ids"));
+    }
+    for (const auto& pair : chg->callNodeToCHAVtblsMap)
+    {
+        std::string vtblsIds = extractNodesIds(pair.second);
+        if (vtblsIds.size() > 0)
+            addRow("ICFG", pair.first->getFun(), getCHNodes2ICFGNodeUpdateStmt(pair.first->getId(), vtblsIds, "cha_vtbls_ids"));
+    }
+    for (const auto& item : *pag->getCallGraph())
+    {
+        const CallGraphNode* node = item.second;
+        addRow("CallGraph", node->getFunction(), callGraphNode2DBString(node));
+        for (auto edgeIter = node->OutEdgeBegin(); edgeIter != node->OutEdgeEnd(); ++edgeIter)
+        {
+            addRow("CallGraph", node->getFunction(), callGraphEdge2DBString(*edgeIter));
+        }
+    }
+
+    // the hashes of the previous write; without those of the CallGraph nodes
+    // nothing tells which rows of the other graphs to replace
+    static const std::vector<std::string> graphs = {"SVFType", "PAG", "BasicBlockGraph", "ICFG", "CHG", "CallGraph"};
+    if (!readContentHash(connection, "CallGraph").empty())
+    {
+        for (const std::string& graph : graphs)
+        {
+            plan->setStoredGraphHash(graph, readContentHash(connection, graph));
+        }
+        DBPageReader reader(connection, "CallGraph", "MATCH (node:CallGraphNode)", "node", {"node.id"});
+        while (DBResult* root = reader.next())
+        {
+            for (const DBValue* row : *root)
+            {
+                const DBValue* data = row->get(DB_FIELD("node"));
+                const DBValue* properties = nullptr != data ? data->get(DB_FIELD("properties")) : nullptr;
+                if (nullptr != properties)
+                {
+                    plan->addStoredFunction(properties->getString(DB_FIELD("fun_name")),
+                                            properties->getInt(DB_FIELD("fun_obj_var_id")),
+                                            properties->getString(DB_FIELD("content_hash")));
+                }
+            }
+            delete root;
+        }
+        // the stmts of a function are found by the ids of its ICFG nodes
+        if (readContentHash(connection, "ICFG").empty())
+        {
+            plan->setStoredGraphHash("PAG", "");
+        }
+    }
+    plan->compare();
+
+    if (plan->isPatched("PAG"))
+    {
+        const std::vector<NodeID>& funIds = plan->getStaleFunIds();
+        const size_t idsPerQuery = std::max(DBPageSize(), 1u);
+        for (size_t begin = 0; begin < funIds.size(); begin += idsPerQuery)
+        {
+            std::string idList = "";
+            for (size_t i = begin; i < std::min(funIds.size(), begin + idsPerQuery); ++i)
+            {
+                idList += (idList.empty() ? "" : ", ") + std::to_string(funIds[i]);
+            }
+            readLabelsFromDB(connection, "ICFG", funICFGNodeTypes, "node", {"node.id"},
+                             [&idList](const std::string& nodeType)
+                             { return "MATCH (node:" + nodeType + ") WHERE node.fun_obj_var_id IN [" + idList + "] WITH node"; },
+                             [this, plan](DBPageReader& reader, const std::string&)
+                             {
+                                 while (DBResult* root = reader.next())
+                                 {
+                                     for (const DBValue* row : *root)
+                                     {
+                                         const DBValue* data = row->get(DB_FIELD("node"));
+                                         const DBValue* properties = nullptr != data ? data->get(DB_FIELD("properties")) : nullptr;
+                                         if (nullptr == properties)
+                                             continue;
+                                         std::string stmtIds = properties->getString(DB_FIELD("pag_edge_ids"));
+                                         for (int stmtId : parseElements2Container<std::vector<int>>(stmtIds))
+                                             plan->addStaleStmtId(stmtId);
+                                     }
+                                     delete root;
+                                 }
+                             });
+        }
+    }
+
+    SVFUtil::outs() << "Incremental write: " << plan->getNumOfRewrittenFunctions() << " of "
+                    << plan->getNumOfFunctions() << " functions rewritten, "
+                    << plan->getStaleFunIds().size() << " replaced or removed; graphs written as a whole:";
+    for (const std::string& graph : graphs)
+    {
+        if (!plan->isPatched(graph))
+            SVFUtil::outs() << " " << graph;
+    }
+    SVFUtil::outs() << "\n";
+    writePlan = plan;
+}
+
+std::string GraphDBClient::readContentHash(lgraph::RpcClient* connection, const std::string& graphname)
+{
+    std::string result;
+    if (nullptr == connection || !connection->CallCypher(result, "MATCH (n:DBVersion) RETURN n.content_hash", graphname))
+        return "";
+    DBResult root(std::move(result));
+    const DBValue* row = root.at(0);
+    return nullptr != row ? row->getString(DB_FIELD("n.content_hash")) : "";
+}
+
+s64_t GraphDBClient::getGraphStamp(const std::string& graphname)
+{
+    {
+        std::lock_guard<std::mutex> lock(writtenStampsMtx);
+        auto it = writtenStamps.find(graphname);
+        if (it != writtenStamps.end())
+            return it->second;
+    }
+    return readVersionStamp(connection, graphname);
+}
+
+/// the function a PAG node belongs to for its key: that of its ICFG node, else
+/// that of its stmts if they are all of one function, else none
+static const FunObjVar* getFunOfNode(const SVFVar* node, const Map<const SVFVar*, const FunObjVar*>& stmtFuns)
+{
+    const ICFGNode* icfgNode = nullptr;
+    if (const ValVar* var = SVFUtil::dyn_cast<ValVar>(node))
+        icfgNode = var->getICFGNode();
+    else if (const BaseObjVar* obj = SVFUtil::dyn_cast<BaseObjVar>(node))
+        icfgNode = obj->getICFGNode();
+    if (nullptr != icfgNode && nullptr != icfgNode->getFun())
+        return icfgNode->getFun();
+    auto it = stmtFuns.find(node);
+    return it != stmtFuns.end() ? it->second : nullptr;
+}
+
+/// what tells a PAG node of no function from the others: kind, name, type and
+/// value, and the function of a parameter or return value
+static std::string getPAGNodeSignature(const SVFVar* node)
+{
+    std::string sig = std::to_string(node->getNodeKind()) + "|" + node->getName() + "|" +
+                      (nullptr != node->getType() ? node->getType()->toString() : "");
+    if (const ConstIntValVar* var = SVFUtil::dyn_cast<ConstIntValVar>(node))
+        sig += "|" + std::to_string(var->getSExtValue());
+    else if (const ConstIntObjVar* obj = SVFUtil::dyn_cast<ConstIntObjVar>(node))
+        sig += "|" + std::to_string(obj->getSExtValue());
+    else if (const ConstFPValVar* var = SVFUtil::dyn_cast<ConstFPValVar>(node))
+        sig += "|" + std::to_string(var->getFPValue());
+    else if (const ConstFPObjVar* obj = SVFUtil::dyn_cast<ConstFPObjVar>(node))
+        sig += "|" + std::to_string(obj->getFPValue());
+    else if (const ArgValVar* arg = SVFUtil::dyn_cast<ArgValVar>(node))
+        sig += "|" + arg->getParent()->getName() + "|" + std::to_string(arg->getArgNo());
+    else if (const RetValPN* ret = SVFUtil::dyn_cast<RetValPN>(node))
+        sig += "|" + ret->getCallGraphNode()->getName();
+    else if (const VarArgValPN* varArg = SVFUtil::dyn_cast<VarArgValPN>(node))
+        sig += "|" + varArg->getFunction()->getName();
+    return sig;
+}
+
+void GraphDBClient::getPAGNodeKeys(SVFIR* pag, DBPAGNodeKeys& keys)
+{
+    // the function of the stmts of each node, nullptr once they are of several
+    Map<const SVFVar*, const FunObjVar*> stmtFuns;
+    for (auto it = pag->begin(); it != pag->end(); ++it)
+    {
+        for (auto edgeIter = it->second->OutEdgeBegin(); edgeIter != it->second->OutEdgeEnd(); ++edgeIter)
+        {
+            const SVFStmt* stmt = *edgeIter;
+            const FunObjVar* fun = getFunOfRow(stmt);
+            for (const SVFVar* node : {stmt->getSrcNode(), stmt->getDstNode()})
+            {
+                auto inserted = stmtFuns.emplace(node, fun);
+                if (!inserted.second && inserted.first->second != fun)
+                    inserted.first->second = nullptr;
+            }
+        }
+    }
+
+    std::vector<std::pair<NodeID, u64_t>> globalNodes;
+    std::vector<const GepObjVar*> gepObjs;
+    for (auto it = pag->begin(); it != pag->end(); ++it)
+    {
+        if (const GepObjVar* gepObj = SVFUtil::dyn_cast<GepObjVar>(it->second))
+        {
+            gepObjs.push_back(gepObj);
+            continue;
+        }
+        const FunObjVar* fun = getFunOfNode(it->second, stmtFuns);
+        if (nullptr != fun)
+            keys.funNodes[fun->getName()].push_back(it->first);
+        else
+            globalNodes.emplace_back(it->first, DBWritePlan::hashRow(getPAGNodeSignature(it->second)));
+    }
+    // the ordinals follow the ids, which keep their order within a function
+    for (auto& item : keys.funNodes)
+    {
+        std::sort(item.second.begin(), item.second.end());
+        for (size_t i = 0; i < item.second.size(); ++i)
+            keys.keys[item.second[i]] = item.first + "#" + std::to_string(i);
+    }
+    std::sort(globalNodes.begin(), globalNodes.end());
+    Map<u64_t, u32_t> numOfAlike;
+    for (const auto& item : globalNodes)
+    {
+        std::string key = "@" + DBWritePlan::toString(item.second) + "#" + std::to_string(numOfAlike[item.second]++);
+        keys.globalNodes[key] = item.first;
+        keys.keys[item.first] = key;
+    }
+    for (const GepObjVar* gepObj : gepObjs)
+    {
+        keys.keys[gepObj->getId()] = keys.getKey(gepObj->getBaseObj()->getId()) + "+" +
+                                     std::to_string(gepObj->getConstantFieldIdx());
+    }
+}
+
+/// the row of a PAG node in the PTA hashes: what the solver takes of it, the
+/// node named by its key
+static std::string getPTANodeRow(const SVFVar* node, const DBPAGNodeKeys& keys)
+{
+    std::string row = keys.getKey(node->getId()) + " " + getPAGNodeSignature(node);
+    if (const BaseObjVar* obj = SVFUtil::dyn_cast<BaseObjVar>(node))
+    {
+        row += " " + std::to_string(obj->getTypeInfo()->getFlag()) + " " +
+               std::to_string(obj->getMaxFieldOffsetLimit()) + " " + std::to_string(obj->getNumOfElements());
+    }
+    else if (const GepValVar* var = SVFUtil::dyn_cast<GepValVar>(node))
+    {
+        row += " " + keys.getKey(var->getBaseNode()->getId()) + " " + std::to_string(var->getConstantFieldIdx());
+    }
+    return row;
+}
+
+/// the row of a PAG stmt in the PTA hashes, its nodes named by their keys
+static std::string getPTAStmtRow(const SVFStmt* stmt, const DBPAGNodeKeys& keys)
+{
+    std::string row = std::to_string(stmt->getEdgeKind()) + " " + keys.getKey(stmt->getSrcID()) + " " +
+                      keys.getKey(stmt->getDstID());
+    if (const GepStmt* gep = SVFUtil::dyn_cast<GepStmt>(stmt))
+    {
+        row += gep->isVariantFieldGep() ? " variant" : " " + std::to_string(gep->getConstantStructFldIdx());
+    }
+    else if (const MultiOpndStmt* multi = SVFUtil::dyn_cast<MultiOpndStmt>(stmt))
+    {
+        for (const SVFVar* opnd : multi->getOpndVars())
+            row += " " + keys.getKey(opnd->getId());
+    }
+    return row;
+}
+
+void GraphDBClient::hashPAGContent(SVFIR* pag, const DBPAGNodeKeys& keys, DBWritePlan& hashes)
+{
+    Map<const FunObjVar*, Set<const SVFVar*>> funNodes;
+    Set<const SVFVar*> nodesOfFuns;
+    for (auto it = pag->begin(); it != pag->end(); ++it)
+    {
+        for (auto edgeIter = it->second->OutEdgeBegin(); edgeIter != it->second->OutEdgeEnd(); ++edgeIter)
+        {
+            const SVFStmt* stmt = *edgeIter;
+            const FunObjVar* fun = getFunOfRow(stmt);
+            if (nullptr != fun)
+            {
+                hashes.addFunctionRow(fun->getName(), getPTAStmtRow(stmt, keys));
+                funNodes[fun].insert(stmt->getSrcNode());
+                funNodes[fun].insert(stmt->getDstNode());
+                nodesOfFuns.insert(stmt->getSrcNode());
+                nodesOfFuns.insert(stmt->getDstNode());
+            }
+            else
+            {
+                hashes.addGraphRow("PAG", getPTAStmtRow(stmt, keys));
+            }
+        }
+    }
+    // a node shared by several functions is a row of each of them
+    for (const auto& item : funNodes)
+    {
+        for (const SVFVar* node : item.second)
+        {
+            hashes.addFunctionRow(item.first->getName(), getPTANodeRow(node, keys));
+        }
+    }
+    // the nodes of a function in none of its stmts are rows of it as well;
+    // not the field objects, the solver adding them to pag after a warm start hashed it
+    for (const auto& item : keys.funNodes)
+    {
+        for (NodeID id : item.second)
+        {
+            const SVFVar* node = pag->getGNode(id);
+            if (nodesOfFuns.find(node) == nodesOfFuns.end())
+                hashes.addFunctionRow(item.first, getPTANodeRow(node, keys));
+        }
+    }
+    for (const auto& item : keys.globalNodes)
+    {
+        const SVFVar* node = pag->getGNode(item.second);
+        if (nodesOfFuns.find(node) == nodesOfFuns.end())
+            hashes.addGraphRow("PAG", getPTANodeRow(node, keys));
+    }
+}
+
+void GraphDBClient::insertPTA2db(BVDataPTAImpl* pta, SVFIR* pag)
+{
+    if (nullptr == connection && !isOfflineMode())
+    {
+        return;
+    }
+    // the points-to sets hold for the PAG graph as it is now
+    s64_t pagStamp = getGraphStamp("PAG");
+    std::unique_ptr<DBBatchWriter> writer(createGraphWriter("PTA",
+        {std::string(WORKSPACE_DIR) + "/src/DBSchema/PTASchema.json"}));
+    std::vector<NodeID> fieldInsensitiveObjs;
+    u32_t numOfPtrs = 0;
+    // getPts() may insert into the points-to map, so no producer threads here
+    for (SVFIR::iterator it = pag->begin(); it != pag->end(); ++it)
+    {
+        if (const GepObjVar* gepObj = SVFUtil::dyn_cast<GepObjVar>(it->second))
+        {
+            writer->addNodeStmt("CREATE (n:PTAGepObjVar {id:" + std::to_string(it->first)
+                                + ", base_obj_var_node_id:" + std::to_string(gepObj->getBaseObj()->getId())
+                                + ", app_offset:" + std::to_string(gepObj->getConstantFieldIdx()) + "})");
+        }
+        else if (const BaseObjVar* baseObj = SVFUtil::dyn_cast<BaseObjVar>(it->second))
+        {
+            if (baseObj->isFieldInsensitive())
+                fieldInsensitiveObjs.push_back(it->first);
+        }
+        const PointsTo& pts = pta->getPts(it->first);
+        if (!pts.empty())
+        {
+            writer->addNodeStmt("CREATE (n:PointsTo {id:" + std::to_string(it->first) + ", pts:'"
+                                + DBIdList::encode(pts.begin(), pts.end(), [](NodeID id) { return id; }) + "'})");
+            ++numOfPtrs;
+        }
+    }
+    // what the points-to sets were computed on, for -pta-warm-start, and the
+    // keys which name their nodes in a later build
+    DBPAGNodeKeys keys;
+    getPAGNodeKeys(pag, keys);
+    DBWritePlan hashes;
+    hashPAGContent(pag, keys, hashes);
+    // and the stmts of every function, for a warm start to undo those of the changed ones
+    Map<std::string, std::vector<s64_t>> funStmts;
+    for (auto it = pag->begin(); it != pag->end(); ++it)
+    {
+        for (auto edgeIter = it->second->OutEdgeBegin(); edgeIter != it->second->OutEdgeEnd(); ++edgeIter)
+        {
+            const SVFStmt* stmt = *edgeIter;
+            const FunObjVar* fun = getFunOfRow(stmt);
+            if (nullptr == fun)
+                continue;
+            std::vector<s64_t>& stmts = funStmts[fun->getName()];
+            stmts.push_back(stmt->getEdgeKind());
+            stmts.push_back(stmt->getSrcID());
+            stmts.push_back(stmt->getDstID());
+        }
+    }
+    for (const auto& item : pag->getIndirectCallsites())
+    {
+        const CallICFGNode* cs = item.first;
+        if (nullptr == cs->getFun())
+            continue;
+        std::vector<s64_t>& stmts = funStmts[cs->getFun()->getName()];
+        stmts.push_back(-1);
+        stmts.push_back(item.second);
+        stmts.push_back(pag->callsiteHasRet(cs->getRetICFGNode())
+                        ? pag->getCallSiteRet(cs->getRetICFGNode())->getId() : item.second);
+    }
+    u32_t funIdx = 0;
+    for (const auto& item : hashes.getFunctionHashes())
+    {
+        const std::vector<s64_t>& stmts = funStmts[item.first];
+        const std::vector<NodeID>& nodes = keys.funNodes[item.first];
+        writer->addNodeStmt("CREATE (n:PTAFunction {id:" + std::to_string(funIdx++) + ", fun_name:'" + item.first
+                            + "', content_hash:'" + DBWritePlan::toString(item.second)
+                            + "', stmts:'" + DBIdList::encode(stmts.begin(), stmts.end(), [](s64_t id) { return id; })
+                            + "', node_ids:'" + DBIdList::encode(nodes.begin(), nodes.end(), [](NodeID id) { return id; })
+                            + "'})");
+    }
+    for (const auto& item : keys.globalNodes)
+    {
+        writer->addNodeStmt("CREATE (n:PTAGlobalNode {id:" + std::to_string(item.second) + ", node_key:'" + item.first
+                            + "'})");
+    }
+    writer->addNodeStmt("CREATE (n:PTAInfo {id:0, pta_ty:" + std::to_string(pta->getAnalysisTy())
+                        + ", pag_stamp:" + std::to_string(pagStamp)
+                        + ", field_insensitive_obj_ids:'" + encodeIds(fieldInsensitiveObjs, [](NodeID id) { return id; })
+                        + "', global_hash:'" + hashes.getGraphHash("PAG") + "'})");
+    writer->flush();
+    SVFUtil::outs() << "Write points-to sets of " << numOfPtrs << " nodes to the PTA graph\n";
+}
+
+bool GraphDBClient::readPTAFromDB(lgraph::RpcClient* connection, const std::string& dbname, DBPTAResult& result)
+{
+    std::string info;
+    // a graph without DBVersion was never (completely) written
+    if (readVersionStamp(connection, dbname) < 0 ||
+        !connection->CallCypher(info, "MATCH (n:PTAInfo) RETURN n", dbname))
+    {
+        return false;
+    }
+    DBResult infoRoot(std::move(info));
+    const DBValue* infoRow = infoRoot.at(0);
+    const DBValue* data = nullptr != infoRow ? infoRow->get(DB_FIELD("n")) : nullptr;
+    const DBValue* properties = nullptr != data ? data->get(DB_FIELD("properties")) : nullptr;
+    if (nullptr == properties)
+    {
+        return false;
+    }
+    result.ptaTy = properties->getInt(DB_FIELD("pta_ty"));
+    result.pagStamp = static_cast<s64_t>(properties->getDouble(DB_FIELD("pag_stamp")));
+    result.globalHash = properties->getString(DB_FIELD("global_hash"));
+    const std::string fiObjIds = properties->getString(DB_FIELD("field_insensitive_obj_ids"));
+    DBIdList::Reader fiReader(fiObjIds);
+    for (s64_t id; fiReader.next(id);)
+    {
+        result.fieldInsensitiveObjs.push_back(id);
+    }
+
+    DBPageReader gepReader(connection, dbname, "MATCH (node:PTAGepObjVar)", "node", {"node.id"});
+    while (DBResult* root = gepReader.next())
+    {
+        for (const DBValue* row : *root)
+        {
+            const DBValue* node = row->get(DB_FIELD("node"));
+            const DBValue* props = nullptr != node ? node->get(DB_FIELD("properties")) : nullptr;
+            if (nullptr != props)
+            {
+                result.gepObjs.emplace_back(props->getInt(DB_FIELD("id")),
+                                            props->getInt(DB_FIELD("base_obj_var_node_id")),
+                                            static_cast<s64_t>(props->getDouble(DB_FIELD("app_offset"))));
+            }
+        }
+        delete root;
+    }
+
+    DBPageReader funReader(connection, dbname, "MATCH (node:PTAFunction)", "node", {"node.id"});
+    while (DBResult* root = funReader.next())
+    {
+        for (const DBValue* row : *root)
+        {
+            const DBValue* node = row->get(DB_FIELD("node"));
+            const DBValue* props = nullptr != node ? node->get(DB_FIELD("properties")) : nullptr;
+            if (nullptr != props)
+            {
+                result.funHashes.emplace_back(props->getString(DB_FIELD("fun_name")),
+                                              props->getString(DB_FIELD("content_hash")));
+                const char* nodes = props->getString(DB_FIELD("node_ids"));
+                std::vector<NodeID>& funNodes = result.funNodes[result.funHashes.back().first];
+                DBIdList::Reader nodeReader(nodes, nodes + strlen(nodes));
+                for (s64_t id; nodeReader.next(id);)
+                {
+                    funNodes.push_back(id);
+                }
+                // absent from the graphs of older builds
+                const char* stmts = props->getString(DB_FIELD("stmts"));
+                if ('\0' == *stmts)
+                    continue;
+                std::vector<s64_t>& funStmts = result.funStmts[result.funHashes.back().first];
+                DBIdList::Reader reader(stmts, stmts + strlen(stmts));
+                for (s64_t id; reader.next(id);)
+                {
+                    funStmts.push_back(id);
+                }
+            }
+        }
+        delete root;
+    }
+
+    DBPageReader keyReader(connection, dbname, "MATCH (node:PTAGlobalNode)", "node", {"node.id"});
+    while (DBResult* root = keyReader.next())
+    {
+        for (const DBValue* row : *root)
+        {
+            const DBValue* node = row->get(DB_FIELD("node"));
+            const DBValue* props = nullptr != node ? node->get(DB_FIELD("properties")) : nullptr;
+            if (nullptr != props)
+            {
+                result.globalNodes.emplace_back(props->getInt(DB_FIELD("id")), props->getString(DB_FIELD("node_key")));
+            }
+        }
+        delete root;
+    }
+
+    DBPageReader ptsReader(connection, dbname, "MATCH (node:PointsTo)", "node", {"node.id"});
+    while (DBResult* root = ptsReader.next())
+    {
+        for (const DBValue* row : *root)
+        {
+            const DBValue* node = row->get(DB_FIELD("node"));
+            const DBValue* props = nullptr != node ? node->get(DB_FIELD("properties")) : nullptr;
+            if (nullptr == props)
+                continue;
+            result.pts.emplace_back(props->getInt(DB_FIELD("id")), std::vector<NodeID>());
+            const char* pts = props->getString(DB_FIELD("pts"));
+            DBIdList::Reader reader(pts, pts + strlen(pts));
+            for (s64_t id; reader.next(id);)
+            {
+                result.pts.back().second.push_back(id);
+            }
+        }
+        delete root;
+    }
+    return true;
+}
+
+std::string GraphDBClient::escapeString(const std::string& str)
+{
+    std::string escaped;
+    escaped.reserve(str.size());
+    for (char c : str)
+    {
+        if (c == '\\' || c == '\'')
+            escaped += '\\';
+        escaped += c;
+    }
+    return escaped;
+}
+
+const SVFVar* GraphDBClient::getValueOfSVFGNode(const VFGNode* node)
+{
+    if (const StmtVFGNode* stmtNode = SVFUtil::dyn_cast<StmtVFGNode>(node))
+        return stmtNode->getPAGDstNode();
+    else if (const PHIVFGNode* phiNode = SVFUtil::dyn_cast<PHIVFGNode>(node))
+        return phiNode->getRes();
+    else if (const ActualParmVFGNode* parmNode = SVFUtil::dyn_cast<ActualParmVFGNode>(node))
+        return parmNode->getParam();
+    else if (const FormalParmVFGNode* parmNode = SVFUtil::dyn_cast<FormalParmVFGNode>(node))
+        return parmNode->getParam();
+    else if (const ActualRetVFGNode* retNode = SVFUtil::dyn_cast<ActualRetVFGNode>(node))
+        return retNode->getRev();
+    else if (const FormalRetVFGNode* retNode = SVFUtil::dyn_cast<FormalRetVFGNode>(node))
+        return retNode->getRet();
+    else if (const NullPtrVFGNode* nullNode = SVFUtil::dyn_cast<NullPtrVFGNode>(node))
+        return nullNode->getPAGNode();
+    else if (const BinaryOPVFGNode* opNode = SVFUtil::dyn_cast<BinaryOPVFGNode>(node))
+        return opNode->getRes();
+    else if (const UnaryOPVFGNode* opNode = SVFUtil::dyn_cast<UnaryOPVFGNode>(node))
+        return opNode->getRes();
+    else if (const CmpVFGNode* cmpNode = SVFUtil::dyn_cast<CmpVFGNode>(node))
+        return cmpNode->getRes();
+    return nullptr;
+}
+
+void GraphDBClient::insertSVFG2db(const std::string& svfgFile)
+{
+    if (nullptr == connection && !isOfflineMode())
+    {
+        return;
+    }
+    std::ifstream in(svfgFile);
+    std::string text((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    if (!in)
+    {
+        SVFUtil::outs() << "Warning: [insertSVFG2db] cannot read the -write-svfg file " << svfgFile << "\n";
+        return;
+    }
+    // the SVFG holds for the PAG graph as it is now
+    s64_t pagStamp = getGraphStamp("PAG");
+    std::unique_ptr<DBBatchWriter> writer(createGraphWriter("SVFG",
+        {std::string(WORKSPACE_DIR) + "/src/DBSchema/SVFGSchema.json"}));
+    writer->addNodeStmt("CREATE (n:SVFGInfo {id:0, pag_stamp:" + std::to_string(pagStamp) + "})");
+    // in chunks, a string property being limited in size
+    u32_t numOfChunks = 0;
+    const size_t chunkSize = 1 << 20;
+    for (size_t pos = 0; pos < text.size(); pos += chunkSize)
+    {
+        writer->addNodeStmt("CREATE (n:SVFGFile {id:" + std::to_string(numOfChunks++) + ", text:'"
+                            + escapeString(text.substr(pos, chunkSize)) + "'})");
+    }
+    writer->flush();
+    SVFUtil::outs() << "Write SVFG to DB: " << numOfChunks << " chunks of the -write-svfg file\n";
+}
+
+bool GraphDBClient::readSVFGFileFromDB(lgraph::RpcClient* connection, const std::string& dbname,
+                                       const std::string& filename)
+{
+    std::string info;
+    if (readVersionStamp(connection, dbname) < 0 ||
+        !connection->CallCypher(info, "MATCH (n:SVFGInfo) RETURN n.pag_stamp", dbname))
+    {
+        return false;
+    }
+    DBResult infoRoot(std::move(info));
+    const DBValue* infoRow = infoRoot.at(0);
+    const DBValue* pagStamp = nullptr != infoRow ? infoRow->get(DB_FIELD("n.pag_stamp")) : nullptr;
+    s64_t stamp = nullptr != pagStamp && pagStamp->isNumber() ? static_cast<s64_t>(pagStamp->valuedouble) : -1;
+    if (stamp != readVersionStamp(connection, "PAG"))
+    {
+        SVFUtil::outs() << "Warning: [readSVFGFileFromDB] the SVFG graph was built on another PAG\n";
+        return false;
+    }
+
+    // the chunks come in id order, the page key
+    std::ofstream out(filename);
+    u32_t numOfChunks = 0;
+    DBPageReader chunkReader(connection, dbname, "MATCH (node:SVFGFile)", "node", {"node.id"});
+    while (DBResult* root = chunkReader.next())
+    {
+        for (const DBValue* row : *root)
+        {
+            const DBValue* node = row->get(DB_FIELD("node"));
+            const DBValue* props = nullptr != node ? node->get(DB_FIELD("properties")) : nullptr;
+            if (nullptr == props)
+                continue;
+            out << props->getString(DB_FIELD("text"));
+            ++numOfChunks;
+        }
+        delete root;
+    }
+    if (0 == numOfChunks)
+    {
+        SVFUtil::outs() << "Warning: [readSVFGFileFromDB] the SVFG graph holds no -write-svfg file\n";
+        return false;
+    }
+    return static_cast<bool>(out);
+}
+
+void GraphDBClient::insertThreadAnalysis2db(MHP* mhp, LockAnalysis* lsa, SVFIR* pag)
+{
+    if (nullptr == connection && !isOfflineMode())
+    {
+        return;
+    }
+    // the analysis holds for the PAG graph as it is now
+    s64_t pagStamp = getGraphStamp("PAG");
+    std::unique_ptr<DBBatchWriter> writer(createGraphWriter("ThreadAnalysis",
+        {std::string(WORKSPACE_DIR) + "/src/DBSchema/ThreadAnalysisSchema.json"}));
+    auto encode = [](const auto& ids) { return DBIdList::encode(ids.begin(), ids.end(), [](NodeID id) { return id; }); };
+
+    TCT* tct = mhp->getTCT();
+    std::vector<std::string> threadStmts;
+    std::vector<std::string> spawnStmts;
+    for (auto it = tct->begin(); it != tct->end(); ++it)
+    {
+        const TCTNode* node = it->second;
+        const ICFGNode* forkSite = node->getCxtThread().getThread();
+        int parentId = -1;
+        if (node->hasIncomingEdge())
+        {
+            parentId = (*node->InEdgeBegin())->getSrcID();
+            spawnStmts.push_back("MATCH (n:Thread{id:" + std::to_string(parentId) + "}), (m:Thread{id:"
+                                 + std::to_string(node->getId()) + "}) WHERE n.id = " + std::to_string(parentId)
+                                 + " AND m.id = " + std::to_string(node->getId()) + " CREATE (n)-[r:ThreadSpawn{}]->(m)");
+        }
+        threadStmts.push_back("CREATE (n:Thread {id:" + std::to_string(node->getId())
+                              + ", fork_site_id:" + std::to_string(nullptr != forkSite ? static_cast<int>(forkSite->getId()) : -1)
+                              + ", parent_id:" + std::to_string(parentId)
+                              + ", multiforked:" + (node->isMultiforked() ? "true" : "false")
+                              + ", cxt:'" + encode(node->getCxtThread().getContext()) + "'})");
+    }
+
+    // the fork/join sites with the ids of their TDForkPE/TDJoinPE edges
+    OrderedMap<NodeID, std::pair<bool, std::vector<NodeID>>> sites;
+    for (const SVFStmt* stmt : pag->getSVFStmtSet(SVFStmt::ThreadFork))
+    {
+        auto& site = sites[stmt->getICFGNode()->getId()];
+        site.first = true;
+        site.second.push_back(stmt->getEdgeID());
+    }
+    for (const SVFStmt* stmt : pag->getSVFStmtSet(SVFStmt::ThreadJoin))
+    {
+        sites[stmt->getICFGNode()->getId()].second.push_back(stmt->getEdgeID());
+    }
+    std::vector<std::string> siteStmts;
+    for (const auto& site : sites)
+    {
+        siteStmts.push_back("CREATE (n:ThreadSite {id:" + std::to_string(site.first)
+                            + ", is_fork:" + (site.second.first ? "true" : "false")
+                            + ", pe_ids:'" + encode(site.second.second) + "'})");
+    }
+
+    // the contexts folded: per thread, the threads its contexts of the statement
+    // interleave with and the locks held in all of them
+    std::vector<std::string> stmtStmts;
+    for (auto it = pag->getICFG()->begin(); it != pag->getICFG()->end(); ++it)
+    {
+        const ICFGNode* node = it->second;
+        if (!mhp->hasThreadStmtSet(node))
+            continue;
+        OrderedMap<NodeID, NodeBS> interleavings;
+        for (const CxtThreadStmt& cts : mhp->getThreadStmtSet(node))
+        {
+            NodeBS& interleaving = interleavings[cts.getTid()];
+            if (mhp->hasInterleavingThreads(cts))
+                interleaving |= mhp->getInterleavingThreads(cts);
+        }
+        std::vector<NodeID> threadIds;
+        std::string interleavingIds;
+        for (const auto& item : interleavings)
+        {
+            if (!threadIds.empty())
+                interleavingIds += ",";
+            threadIds.push_back(item.first);
+            interleavingIds += encode(item.second);
+        }
+
+        OrderedSet<NodeID> lockSiteIds;
+        if (lsa->isInsideIntraLock(node))
+        {
+            for (const ICFGNode* lock : lsa->getIntraLockSet(node))
+                lockSiteIds.insert(lock->getId());
+        }
+        if (lsa->hasCxtStmtfromInst(node))
+        {
+            bool first = true;
+            OrderedSet<NodeID> held;
+            for (const CxtStmt& cs : lsa->getCxtStmtfromInst(node))
+            {
+                OrderedSet<NodeID> locks;
+                if (lsa->hasCxtLockfromCxtStmt(cs))
+                {
+                    for (const CxtLock& lock : lsa->getCxtLockfromCxtStmt(cs))
+                        locks.insert(lock.getStmt()->getId());
+                }
+                if (first)
+                {
+                    held = std::move(locks);
+                    first = false;
+                }
+                else
+                {
+                    OrderedSet<NodeID> common;
+                    std::set_intersection(held.begin(), held.end(), locks.begin(), locks.end(),
+                                          std::inserter(common, common.end()));
+                    held = std::move(common);
+                }
+            }
+            lockSiteIds.insert(held.begin(), held.end());
+        }
+        stmtStmts.push_back("CREATE (n:ThreadStmt {id:" + std::to_string(node->getId())
+                            + ", thread_ids:'" + encode(threadIds)
+                            + "', interleaving_thread_ids:'" + interleavingIds
+                            + "', lock_site_ids:'" + encode(lockSiteIds) + "'})");
+    }
+
+    auto identity = [](const std::string& stmt) { return stmt; };
+    addStmts2Writer(threadStmts, identity, writer.get(), false);
+    addStmts2Writer(siteStmts, identity, writer.get(), false);
+    addStmts2Writer(stmtStmts, identity, writer.get(), false);
+    writer->addNodeStmt("CREATE (n:ThreadAnalysisInfo {id:0, pag_stamp:" + std::to_string(pagStamp) + "})");
+    writer->flush();
+    addStmts2Writer(spawnStmts, identity, writer.get(), true);
+    writer->flush();
+    SVFUtil::outs() << "Write ThreadAnalysis to DB: " << threadStmts.size() << " threads, "
+                    << siteStmts.size() << " fork/join sites, " << stmtStmts.size() << " statements\n";
+}
+
+bool GraphDBClient::readThreadAnalysisFromDB(lgraph::RpcClient* connection, const std::string& dbname,
+                                             DBThreadAnalysisResult& result)
+{
+    std::string info;
+    if (readVersionStamp(connection, dbname) < 0 ||
+        !connection->CallCypher(info, "MATCH (n:ThreadAnalysisInfo) RETURN n.pag_stamp", dbname))
+    {
+        return false;
+    }
+    DBResult infoRoot(std::move(info));
+    const DBValue* infoRow = infoRoot.at(0);
+    const DBValue* pagStamp = nullptr != infoRow ? infoRow->get(DB_FIELD("n.pag_stamp")) : nullptr;
+    result.pagStamp = nullptr != pagStamp && pagStamp->isNumber() ? static_cast<s64_t>(pagStamp->valuedouble) : -1;
+    if (result.pagStamp != readVersionStamp(connection, "PAG"))
+    {
+        SVFUtil::outs() << "Warning: [readThreadAnalysisFromDB] the ThreadAnalysis graph was built on another PAG\n";
+        return false;
+    }
+    auto readIds = [](const char* begin, const char* end, std::vector<NodeID>& ids)
+    {
+        DBIdList::Reader reader(begin, end);
+        for (s64_t id; reader.next(id);)
+        {
+            ids.push_back(id);
+        }
+    };
+    auto readAll = [&readIds](const char* str, std::vector<NodeID>& ids)
+    {
+        readIds(str, str + strlen(str), ids);
+    };
+
+    DBPageReader threadReader(connection, dbname, "MATCH (node:Thread)", "node", {"node.id"});
+    while (DBResult* root = threadReader.next())
+    {
+        for (const DBValue* row : *root)
+        {
+            const DBValue* node = row->get(DB_FIELD("node"));
+            const DBValue* props = nullptr != node ? node->get(DB_FIELD("properties")) : nullptr;
+            if (nullptr == props)
+                continue;
+            DBThreadAnalysisResult::Thread thread;
+            thread.id = props->getInt(DB_FIELD("id"));
+            thread.forkSiteId = props->getInt(DB_FIELD("fork_site_id"));
+            thread.parentId = props->getInt(DB_FIELD("parent_id"));
+            thread.multiforked = props->getBool(DB_FIELD("multiforked"));
+            readAll(props->getString(DB_FIELD("cxt")), thread.cxt);
+            result.threads.push_back(std::move(thread));
+        }
+        delete root;
+    }
+
+    DBPageReader siteReader(connection, dbname, "MATCH (node:ThreadSite)", "node", {"node.id"});
+    while (DBResult* root = siteReader.next())
+    {
+        for (const DBValue* row : *root)
+        {
+            const DBValue* node = row->get(DB_FIELD("node"));
+            const DBValue* props = nullptr != node ? node->get(DB_FIELD("properties")) : nullptr;
+            if (nullptr == props)
+                continue;
+            DBThreadAnalysisResult::Site site;
+            site.id = props->getInt(DB_FIELD("id"));
+            site.isFork = props->getBool(DB_FIELD("is_fork"));
+            readAll(props->getString(DB_FIELD("pe_ids")), site.peIds);
+            result.sites.push_back(std::move(site));
+        }
+        delete root;
+    }
+
+    DBPageReader stmtReader(connection, dbname, "MATCH (node:ThreadStmt)", "node", {"node.id"});
+    while (DBResult* root = stmtReader.next())
+    {
+        for (const DBValue* row : *root)
+        {
+            const DBValue* node = row->get(DB_FIELD("node"));
+            const DBValue* props = nullptr != node ? node->get(DB_FIELD("properties")) : nullptr;
+            if (nullptr == props)
+                continue;
+            DBThreadAnalysisResult::Stmt stmt;
+            stmt.id = props->getInt(DB_FIELD("id"));
+            readAll(props->getString(DB_FIELD("thread_ids")), stmt.threadIds);
+            readAll(props->getString(DB_FIELD("lock_site_ids")), stmt.lockSiteIds);
+            // one comma separated list per thread
+            const char* begin = props->getString(DB_FIELD("interleaving_thread_ids"));
+            const char* end = begin + strlen(begin);
+            for (size_t i = 0; i < stmt.threadIds.size(); ++i)
+            {
+                const char* comma = std::find(begin, end, ',');
+                stmt.interleavingThreadIds.emplace_back();
+                readIds(begin, comma, stmt.interleavingThreadIds.back());
+                begin = comma == end ? end : comma + 1;
+            }
+            result.stmts.push_back(std::move(stmt));
+        }
+        delete root;
+    }
+    return true;
+}
+
+std::string GraphDBClient::getBugReportInsertStmt(s64_t runId, const DBBugReport& report)
+{
+    // plain decimal lists, for cypher's split() to take them apart
+    auto join = [](const std::vector<NodeID>& ids)
+    {
+        std::string str;
+        for (NodeID id : ids)
+        {
+            str += (str.empty() ? "" : ",") + std::to_string(id);
+        }
+        return str;
+    };
+    return "CREATE (n:BugReport {id:'" + std::to_string(runId) + "-" + std::to_string(report.id)
+           + "', run_id:" + std::to_string(runId)
+           + ", idx:" + std::to_string(report.id)
+           + ", kind:'" + report.kind
+           + "', fingerprint:'" + report.fingerprint
+           + "', source_icfg_node_id:" + std::to_string(report.sourceICFGNodeId)
+           + ", source_pag_node_id:" + std::to_string(report.sourcePAGNodeId)
+           + ", source_loc:'" + escapeString(report.sourceLoc)
+           + "', sink_icfg_node_ids:'" + join(report.sinkICFGNodeIds)
+           + "', sink_pag_node_ids:'" + join(report.sinkPAGNodeIds)
+           + "', path_svfg_node_ids:'" + join(report.pathSVFGNodeIds)
+           + "', path_icfg_node_ids:'" + join(report.pathICFGNodeIds) + "'})";
+}
+
+void GraphDBClient::insertBugReports2db(const std::vector<DBBugReport>& reports)
+{
+    if (nullptr == connection && !isOfflineMode())
+    {
+        return;
+    }
+    // a run is known by the time it wrote in ms, exact as a JSON number, the ids
+    // of its reports by the PAG and ICFG graphs as they are now
+    s64_t runId = std::chrono::duration_cast<std::chrono::milliseconds>(
+                      std::chrono::system_clock::now().time_since_epoch()).count();
+    std::vector<std::string> stmts;
+    for (const DBBugReport& report : reports)
+    {
+        stmts.push_back(getBugReportInsertStmt(runId, report));
+    }
+    stmts.push_back("CREATE (n:BugReportRun {id:" + std::to_string(runId)
+                    + ", pag_stamp:" + std::to_string(getGraphStamp("PAG"))
+                    + ", icfg_stamp:" + std::to_string(getGraphStamp("ICFG"))
+                    + ", num_of_reports:" + std::to_string(reports.size()) + "})");
+
+    // the graph keeps the reports of the runs before, so it is not recreated
+    // like the others: offline, the run is appended after the import
+    if (isOfflineMode())
+    {
+        SVFUtil::outs() << "Note: the BugReport run is in post_import.cypher, for a server already holding the BugReport graph\n";
+        for (const std::string& stmt : stmts)
+        {
+            DBOfflineWriter::appendPostImportStmt(Write2DBOfflineDir(), "BugReport", stmt);
+        }
+        return;
+    }
+    std::string result;
+    if (!connection->CallCypher(result, "MATCH (n:BugReportRun) RETURN count(n)", "BugReport"))
+    {
+        createSubGraph(connection, "BugReport");
+        loadSchema(connection, std::string(WORKSPACE_DIR) + "/src/DBSchema/BugReportSchema.json", "BugReport");
+        loadSchema(connection, std::string(WORKSPACE_DIR) + "/src/DBSchema/DBVersionSchema.json", "BugReport");
+        connection->CallCypher(result, "CREATE (n:DBVersion {id:0, stamp:" + std::to_string(runId) + "})", "BugReport");
+    }
+    DBBatchWriter writer(connection, "BugReport", DBBatchSize());
+    for (const std::string& stmt : stmts)
+    {
+        writer.addNodeStmt(stmt);
+    }
+    writer.flush();
+    SVFUtil::outs() << "Write BugReport to DB: " << reports.size() << " reports of run " << runId << "\n";
+}
+
+bool GraphDBClient::readBugReportsFromDB(lgraph::RpcClient* connection, const std::string& dbname, s64_t runId,
+                                         DBBugReportResult& result)
+{
+    std::string info;
+    std::string runMatch = runId < 0 ? "MATCH (n:BugReportRun) RETURN n ORDER BY n.id DESC LIMIT 1"
+                                     : "MATCH (n:BugReportRun {id:" + std::to_string(runId) + "}) RETURN n";
+    if (nullptr == connection || !connection->CallCypher(info, runMatch, dbname))
+    {
+        return false;
+    }
+    DBResult infoRoot(std::move(info));
+    const DBValue* infoRow = infoRoot.at(0);
+    const DBValue* data = nullptr != infoRow ? infoRow->get(DB_FIELD("n")) : nullptr;
+    const DBValue* properties = nullptr != data ? data->get(DB_FIELD("properties")) : nullptr;
+    if (nullptr == properties)
+    {
+        return false;
+    }
+    result.runId = static_cast<s64_t>(properties->getDouble(DB_FIELD("id")));
+    result.pagStamp = static_cast<s64_t>(properties->getDouble(DB_FIELD("pag_stamp")));
+    result.icfgStamp = static_cast<s64_t>(properties->getDouble(DB_FIELD("icfg_stamp")));
+    auto readIds = [](const char* str, std::vector<NodeID>& ids)
+    {
+        DBIdList::Reader reader(str, str + strlen(str));
+        for (s64_t id; reader.next(id);)
+        {
+            ids.push_back(id);
+        }
+    };
+
+    // by the index on run_id
+    DBPageReader reportReader(connection, dbname,
+                              "MATCH (node:BugReport {run_id:" + std::to_string(result.runId) + "})",
+                              "node", {"node.idx"});
+    while (DBResult* root = reportReader.next())
+    {
+        for (const DBValue* row : *root)
+        {
+            const DBValue* node = row->get(DB_FIELD("node"));
+            const DBValue* props = nullptr != node ? node->get(DB_FIELD("properties")) : nullptr;
+            if (nullptr == props)
+                continue;
+            DBBugReport report;
+            report.id = props->getInt(DB_FIELD("idx"));
+            report.kind = props->getString(DB_FIELD("kind"));
+            report.fingerprint = props->getString(DB_FIELD("fingerprint"));
+            report.sourceICFGNodeId = props->getInt(DB_FIELD("source_icfg_node_id"));
+            report.sourcePAGNodeId = props->getInt(DB_FIELD("source_pag_node_id"));
+            report.sourceLoc = props->getString(DB_FIELD("source_loc"));
+            readIds(props->getString(DB_FIELD("sink_icfg_node_ids")), report.sinkICFGNodeIds);
+            readIds(props->getString(DB_FIELD("sink_pag_node_ids")), report.sinkPAGNodeIds);
+            readIds(props->getString(DB_FIELD("path_svfg_node_ids")), report.pathSVFGNodeIds);
+            readIds(props->getString(DB_FIELD("path_icfg_node_ids")), report.pathICFGNodeIds);
+            result.reports.push_back(std::move(report));
+        }
+        delete root;
+    }
+    return true;
+}
+
+std::string GraphDBClient::getProcedureFile(const std::string& name)
+{
+    std::string dir = DBProcedureDir();
+    if (dir.empty())
+    {
+        // installed as <prefix>/bin/graphdb-* and <prefix>/procedures/*.so,
+        // the build tree has the same layout
+        char exe[PATH_MAX];
+        ssize_t len = readlink("/proc/self/exe", exe, sizeof(exe) - 1);
+        std::string exePath = len > 0 ? std::string(exe, len) : "";
+        size_t slash = exePath.rfind('/');
+        dir = (slash != std::string::npos ? exePath.substr(0, slash) : ".") + "/../procedures";
+    }
+    return dir + "/" + name + ".so";
+}
+
+void GraphDBClient::loadProcedures2db()
+{
+    if (nullptr == connection)
+    {
+        SVFUtil::outs() << "Warning: [loadProcedures2db] no connection, the stored procedures are not loaded\n";
+        return;
+    }
+    const std::vector<std::pair<std::string, std::string>> procedures = {
+        {"svf_icfg_reach", "ICFG"},
+        {"svf_points_to", "PAG"},
+    };
+    for (const auto& procedure : procedures)
+    {
+        if (!std::ifstream(getProcedureFile(procedure.first)).good())
+        {
+            SVFUtil::outs() << "Warning: [loadProcedures2db] no " << getProcedureFile(procedure.first)
+                            << ", see -db-procedure-dir\n";
+            continue;
+        }
+        loadProcedure(connection, procedure.first, procedure.second, true);
+    }
+}
+
+bool GraphDBClient::loadProcedure(lgraph::RpcClient* connection, const std::string& name,
+                                  const std::string& graph, bool readOnly)
+{
+    std::string file = getProcedureFile(name);
+    if (nullptr == connection || !std::ifstream(file).good())
+    {
+        return false;
+    }
+    std::string result;
+    // a graph patched by -write2db-incremental keeps the one loaded before
+    connection->DeleteProcedure(result, "CPP", name, graph);
+    if (!connection->LoadProcedure(result, file, "CPP", name, "SO", "SVF-GraphDB " + name, readOnly, "v1", graph))
+    {
+        SVFUtil::outs() << "Warning: [loadProcedure] failed to load " << file << " into " << graph << ": "
+                        << result << "\n";
+        return false;
+    }
+    return true;
+}
+
+bool GraphDBClient::callProcedure(const std::string& graph, const std::string& name, const std::string& param,
+                                  std::string& result)
+{
+    if (nullptr == connection)
+    {
+        return false;
+    }
+    return connection->CallProcedure(result, "CPP", name, param, 0.0, false, graph);
+}
+
+void GraphDBClient::queryProcedures()
+{
+    auto query = [this](const std::string& ids, const std::string& graph, const std::string& name)
+    {
+        DBIdList::Reader reader(ids);
+        s64_t id;
+        while (reader.next(id))
+        {
+            std::string result;
+            if (callProcedure(graph, name, "{\"id\":" + std::to_string(id) + "}", result))
+                SVFUtil::outs() << name << "(" << id << "): " << result << "\n";
+            else
+                SVFUtil::outs() << "Warning: [queryProcedures] " << name << "(" << id << ") failed, "
+                                << "is it loaded (-db-procedures)? " << result << "\n";
+        }
+    };
+    query(DBQueryPts(), "PAG", "svf_points_to");
+    query(DBQueryReach(), "ICFG", "svf_icfg_reach");
+}
+
+void GraphDBClient::openSnapshot(lgraph::RpcClient* connection)
 {
-    if (nullptr != connection)
+    if (DBSnapshotFile().empty() || nullptr != snapshot)
+        return;
+    DBSnapshot::GraphStamps stamps;
+    for (const std::string graphname : {"SVFType", "PAG", "BasicBlockGraph", "ICFG", "CHG", "CallGraph"})
     {
-        std::string queryStatement;
-        if(const IntraCFGEdge* cfgEdge = SVFUtil::dyn_cast<IntraCFGEdge>(edge))
+        s64_t stamp = readVersionStamp(connection, graphname);
+        if (stamp < 0)
         {
-            queryStatement = intraCFGEdge2DBString(cfgEdge);
+            SVFUtil::outs() << "Warning: [openSnapshot] " << graphname
+                            << " has no version stamp (written by an older build?), -db-snapshot is ignored\n";
+            return;
         }
-        else if (const CallCFGEdge* cfgEdge = SVFUtil::dyn_cast<CallCFGEdge>(edge))
+        stamps.emplace_back(graphname, stamp);
+    }
+    snapshot = new DBSnapshot(DBSnapshotFile(), stamps);
+    DBSnapshot::setActive(snapshot);
+}
+
+void GraphDBClient::closeSnapshot()
+{
+    if (nullptr == snapshot)
+        return;
+    DBSnapshot::setActive(nullptr);
+    snapshot->save();
+    delete snapshot;
+    snapshot = nullptr;
+}
+
+DBConnectionPool* GraphDBClient::getConnectionPool()
+{
+    std::lock_guard<std::mutex> lock(connectionPoolMtx);
+    if (nullptr == connectionPool)
+    {
+        connectionPool = new DBConnectionPool(DBThreads() > 0 ? DBThreads() : 1, createConnection);
+    }
+    return connectionPool;
+}
+
+u32_t GraphDBClient::readRowCountFromDB(lgraph::RpcClient* connection, const std::string& dbname,
+                                        const std::vector<std::string>& labels, bool isEdge)
+{
+    u32_t numOfRows = 0;
+    for (const std::string& label : labels)
+    {
+        std::string queryStatement = isEdge ? "MATCH ()-[edge:" + label + "]->() RETURN count(edge) AS num"
+                                            : "MATCH (node:" + label + ") RETURN count(node) AS num";
+        DBResult* root = queryFromDB(connection, dbname, queryStatement);
+        if (nullptr != root)
         {
-            queryStatement = callCFGEdge2DBString(cfgEdge);
+            if (root->size() > 0)
+            {
+                numOfRows += static_cast<u32_t>(root->at(0)->getInt(DB_FIELD("num")));
+            }
+            delete root;
         }
-        else if (const RetCFGEdge* cfgEdge = SVFUtil::dyn_cast<RetCFGEdge>(edge))
+    }
+    return numOfRows;
+}
+
+void GraphDBClient::releaseDBLoadTables()
+{
+    getLoadSession().clear();
+}
+
+void GraphDBClient::readLabelsFromDB(lgraph::RpcClient* connection, const std::string& dbname,
+                                     const std::vector<std::string>& labels, const std::string& returnVar,
+                                     const std::vector<std::string>& keyExprs,
+                                     const std::function<std::string(const std::string&)>& getMatchStmt,
+                                     const std::function<void(DBPageReader&, const std::string&)>& readLabel)
+{
+    // with several connections every label is fetched and decoded by its own reader
+    // right away, while the graph is still built one label at a time in the given
+    // order (and each label in key order) so that the result does not depend on
+    // which stream the server answers first
+    const bool concurrent = DBThreads() > 1 && DBPrefetchPages() > 0;
+    std::vector<std::unique_ptr<DBPageReader>> readers(labels.size());
+    if (concurrent)
+    {
+        DBConnectionPool* pool = getConnectionPool();
+        for (size_t i = 0; i < labels.size(); ++i)
         {
-            queryStatement = retCFGEdge2DBString(cfgEdge);
+            readers[i].reset(new DBPageReader(pool, dbname, getMatchStmt(labels[i]), returnVar, keyExprs));
         }
-        else 
+    }
+    for (size_t i = 0; i < labels.size(); ++i)
+    {
+        if (!readers[i])
         {
-            assert("unknown icfg edge type?");
-            return false;
+            readers[i].reset(new DBPageReader(connection, dbname, getMatchStmt(labels[i]), returnVar, keyExprs));
         }
+        readLabel(*readers[i], labels[i]);
+        readers[i].reset();
+    }
+}
+
+std::string GraphDBClient::getICFGEdgeInsertStmt(const ICFGEdge* edge)
+{
+    std::string queryStatement = "";
+    if(const IntraCFGEdge* cfgEdge = SVFUtil::dyn_cast<IntraCFGEdge>(edge))
+    {
+        queryStatement = intraCFGEdge2DBString(cfgEdge);
+    }
+    else if (const CallCFGEdge* cfgEdge = SVFUtil::dyn_cast<CallCFGEdge>(edge))
+    {
+        queryStatement = callCFGEdge2DBString(cfgEdge);
+    }
+    else if (const RetCFGEdge* cfgEdge = SVFUtil::dyn_cast<RetCFGEdge>(edge))
+    {
+        queryStatement = retCFGEdge2DBString(cfgEdge);
+    }
+    else 
+    {
+        assert("unknown icfg edge type?");
+    }
+    return queryStatement;
+}
+
+bool GraphDBClient::addICFGEdge2db(lgraph::RpcClient* connection,
+                                   const ICFGEdge* edge,
+                                   const std::string& dbname)
+{
+    if (nullptr != connection)
+    {
+        std::string queryStatement = getICFGEdgeInsertStmt(edge);
         // SVFUtil::outs() << "ICFGEdge Query Statement:" << queryStatement << "\n";
         std::string result;
         if (queryStatement.empty())
@@ -92,43 +1535,47 @@ bool GraphDBClient::addICFGEdge2db(lgraph::RpcClient* connection,
     return false;
 }
 
+std::string GraphDBClient::getICFGNodeInsertStmt(const ICFGNode* node)
+{
+    std::string queryStatement = "";
+    if(const GlobalICFGNode* globalICFGNode = SVFUtil::dyn_cast<GlobalICFGNode>(node))
+    {
+       queryStatement = globalICFGNode2DBString(globalICFGNode);
+    }
+    else if (const IntraICFGNode* intraICFGNode = SVFUtil::dyn_cast<IntraICFGNode>(node))
+    {
+        queryStatement = intraICFGNode2DBString(intraICFGNode);
+    }
+    else if (const FunEntryICFGNode* funEntryICFGNode = SVFUtil::dyn_cast<FunEntryICFGNode>(node))
+    {
+        queryStatement = funEntryICFGNode2DBString(funEntryICFGNode);
+    }
+    else if (const FunExitICFGNode* funExitICFGNode = SVFUtil::dyn_cast<FunExitICFGNode>(node))
+    {
+        queryStatement = funExitICFGNode2DBString(funExitICFGNode);
+    }
+    else if (const CallICFGNode* callICFGNode = SVFUtil::dyn_cast<CallICFGNode>(node))
+    {
+        queryStatement = callICFGNode2DBString(callICFGNode);
+    }
+    else if (const RetICFGNode* retICFGNode = SVFUtil::dyn_cast<RetICFGNode>(node))
+    {
+        queryStatement = retICFGNode2DBString(retICFGNode);
+    }
+    else 
+    {
+        assert("unknown icfg node type?");
+    }
+    return queryStatement;
+}
+
 bool GraphDBClient::addICFGNode2db(lgraph::RpcClient* connection,
                                    const ICFGNode* node,
                                    const std::string& dbname)
 {
     if (nullptr != connection)
     {
-        std::string queryStatement;
-        if(const GlobalICFGNode* globalICFGNode = SVFUtil::dyn_cast<GlobalICFGNode>(node))
-        {
-           queryStatement = globalICFGNode2DBString(globalICFGNode);
-        }
-        else if (const IntraICFGNode* intraICFGNode = SVFUtil::dyn_cast<IntraICFGNode>(node))
-        {
-            queryStatement = intraICFGNode2DBString(intraICFGNode);
-        }
-        else if (const FunEntryICFGNode* funEntryICFGNode = SVFUtil::dyn_cast<FunEntryICFGNode>(node))
-        {
-            queryStatement = funEntryICFGNode2DBString(funEntryICFGNode);
-        }
-        else if (const FunExitICFGNode* funExitICFGNode = SVFUtil::dyn_cast<FunExitICFGNode>(node))
-        {
-            queryStatement = funExitICFGNode2DBString(funExitICFGNode);
-        }
-        else if (const CallICFGNode* callICFGNode = SVFUtil::dyn_cast<CallICFGNode>(node))
-        {
-            queryStatement = callICFGNode2DBString(callICFGNode);
-        }
-        else if (const RetICFGNode* retICFGNode = SVFUtil::dyn_cast<RetICFGNode>(node))
-        {
-            queryStatement = retICFGNode2DBString(retICFGNode);
-        }
-        else 
-        {
-            assert("unknown icfg node type?");
-            return false;
-        }
-
+        std::string queryStatement = getICFGNodeInsertStmt(node);
         // SVFUtil::outs()<<"ICFGNode Insert Query:"<<queryStatement<<"\n";
         std::string result;
         if (queryStatement.empty())
@@ -191,11 +1638,11 @@ bool GraphDBClient::addCallGraphEdge2db(lgraph::RpcClient* connection,
 std::vector<int> GraphDBClient::stringToIds(const std::string& str)
 {
     std::vector<int> ids;
-    std::istringstream iss(str);
-    std::string token;
-    while (std::getline(iss, token, ','))
+    DBIdList::Reader reader(str);
+    s64_t id;
+    while (reader.next(id))
     {
-        ids.push_back(std::stoi(token));
+        ids.push_back(static_cast<int>(id));
     }
     return ids;
 }
@@ -244,35 +1691,40 @@ void GraphDBClient::insertCHG2db(const CHGraph* chg)
     std::string chgEdgePath =
         std::string(WORKSPACE_DIR) +  "/src/DBSchema/CHGEdgeSchema.json";
     // add all CHG Node & Edge to DB
-    if (nullptr != connection)
+    if (nullptr != connection || isOfflineMode())
     {
-        // create a new graph name CHG in db
-        createSubGraph(connection, "CHG");
-        // load schema for CHG
-        loadSchema(connection, chgEdgePath.c_str(), "CHG");
-        loadSchema(connection, chgNodePath.c_str(), "CHG");
-        std::vector<const CHEdge*> edges;
-        for (auto it = chg->begin(); it != chg->end(); ++it)
+        // an unchanged CHG is kept as it is under -write2db-incremental
+        if (!isGraphPatched("CHG"))
         {
-            CHNode* node = it->second;
-            insertCHNode2db(connection, node, "CHG");
-            for (auto edgeIter = node->OutEdgeBegin();
-                 edgeIter != node->OutEdgeEnd(); ++edgeIter)
+            // create a new graph name CHG in db and load schema for CHG
+            std::unique_ptr<DBBatchWriter> writer(createGraphWriter("CHG", {chgEdgePath, chgNodePath}));
+            std::vector<const CHNode*> nodes;
+            std::vector<const CHEdge*> edges;
+            for (auto it = chg->begin(); it != chg->end(); ++it)
             {
-                CHEdge* edge = *edgeIter;
-                edges.push_back(edge);
+                CHNode* node = it->second;
+                nodes.push_back(node);
+                for (auto edgeIter = node->OutEdgeBegin();
+                     edgeIter != node->OutEdgeEnd(); ++edgeIter)
+                {
+                    CHEdge* edge = *edgeIter;
+                    edges.push_back(edge);
+                }
             }
+            addStmts2Writer(nodes, [this](const CHNode* node) { return getCHNodeInsertStmt(node); },
+                            writer.get(), false);
+            writer->flush();
+            addStmts2Writer(edges, [this](const CHEdge* edge) { return getCHEdgeInsertStmt(edge); },
+                            writer.get(), true);
+            writer->flush();
         }
-        for (const auto& edge : edges)
-        {
-            insertCHEdge2db(connection, edge, "CHG");
-        }
+        // the call nodes written again by insertICFG2db() need their fields set again
         for (const auto& pair : chg->callNodeToClassesMap)
         {
             const ICFGNode* icfgNode = pair.first;
             Set<const CHNode*> nodes = pair.second;
             std::string chNodes = extractNodesIds(nodes);
-            if (chNodes.size()>0)
+            if (chNodes.size()>0 && isRowWritten("ICFG", icfgNode->getFun()))
                 updateCHNodes2ICFGNode(connection, "ICFG", icfgNode->getId(), chNodes, "chnodes_ids");
         }
         for (const auto& pair : chg->callNodeToCHAVtblsMap)
@@ -280,7 +1732,7 @@ void GraphDBClient::insertCHG2db(const CHGraph* chg)
             const ICFGNode* icfgNode = pair.first;
             Set<const GlobalObjVar*> vtables = pair.second;
             std::string vtblsIds = extractNodesIds(vtables);
-            if (vtblsIds.size()>0)
+            if (vtblsIds.size()>0 && isRowWritten("ICFG", icfgNode->getFun()))
                 updateCHNodes2ICFGNode(connection, "ICFG", icfgNode->getId(), vtblsIds, "cha_vtbls_ids");
         }
     }
@@ -288,10 +1740,15 @@ void GraphDBClient::insertCHG2db(const CHGraph* chg)
 
 void GraphDBClient::updateCHNodes2ICFGNode(lgraph::RpcClient* connection, const std::string& dbname, const int icfgId, const std::string& dataStr, const std::string& fieldName)
 {
-    if(nullptr != connection)
+    if (isOfflineMode())
     {
-        std::string queryStatement;
-        std::string nodeUpdateStatement = "MATCH (n{id:"+std::to_string(icfgId)+"}) SET n."+fieldName+" ='"+ dataStr + "'";
+        // the ICFG is imported on its own, apply the update after its import
+        DBOfflineWriter::appendPostImportStmt(Write2DBOfflineDir(), dbname,
+            getCHNodes2ICFGNodeUpdateStmt(icfgId, dataStr, fieldName));
+    }
+    else if(nullptr != connection)
+    {
+        std::string nodeUpdateStatement = getCHNodes2ICFGNodeUpdateStmt(icfgId, dataStr, fieldName);
         std::string result;
         bool ret = connection->CallCypher(result, nodeUpdateStatement, dbname);
         if (!ret)
@@ -302,6 +1759,11 @@ void GraphDBClient::updateCHNodes2ICFGNode(lgraph::RpcClient* connection, const
     }
 }
 
+std::string GraphDBClient::getCHNodes2ICFGNodeUpdateStmt(const int icfgId, const std::string& dataStr, const std::string& fieldName)
+{
+    return "MATCH (n{id:"+std::to_string(icfgId)+"}) SET n."+fieldName+" ='"+ dataStr + "'";
+}
+
 void GraphDBClient::updateCallNode2ClassesMap(const ICFGNode* icfgNode, Set<int> chNodeIds, CHGraph* chg)
 {
     if (nullptr != icfgNode)
@@ -381,10 +1843,10 @@ std::string GraphDBClient::getCHNodeInsertStmt(const CHNode* node)
 std::string GraphDBClient::getCHEdgeInsertStmt(const CHEdge* edge)
 {
     const std::string queryStatement = 
-        "MATCH (n:CHNode{class_name:'"+edge->getSrcNode()->getName()+"'}), (m:CHNode{class_name:'"+edge->getDstNode()->getName()+"'}) WHERE n.class_name = '" +
-        edge->getSrcNode()->getName() +
-        "' AND m.class_name = '" + edge->getDstNode()->getName() +
-        "' CREATE (n)-[r:CHEdge{edge_type:" + std::to_string(edge->getEdgeType()) +
+        "MATCH (n:CHNode{id:"+std::to_string(edge->getSrcID())+"}), (m:CHNode{id:"+std::to_string(edge->getDstID())+"}) WHERE n.id = " +
+        std::to_string(edge->getSrcID()) +
+        " AND m.id = " + std::to_string(edge->getDstID()) +
+        " CREATE (n)-[r:CHEdge{edge_type:" + std::to_string(edge->getEdgeType()) +
         "}]->(m)";
     return queryStatement;
 }
@@ -417,33 +1879,37 @@ void GraphDBClient::insertCHEdge2db(lgraph::RpcClient* connection, const CHEdge*
 void GraphDBClient::insertICFG2db(const ICFG* icfg)
 {
     // add all ICFG Node & Edge to DB
-    if (nullptr != connection)
+    if ((nullptr != connection || isOfflineMode()) && needsWrite("ICFG"))
     {
-        // create a new graph name ICFG in db
-        createSubGraph(connection, "ICFG");
-        // load schema for CallGraph
+        // create a new graph name ICFG in db and load schema for ICFG
         std::string ICFGNodePath =
             std::string(WORKSPACE_DIR) +  "/src/DBSchema/ICFGNodeSchema.json";
         std::string ICFGEdgePath =
             std::string(WORKSPACE_DIR) +  "/src/DBSchema/ICFGEdgeSchema.json";
-        loadSchema(connection, ICFGNodePath.c_str(), "ICFG");
-        loadSchema(connection, ICFGEdgePath.c_str(), "ICFG");
+        std::unique_ptr<DBBatchWriter> writer(createGraphWriter("ICFG", {ICFGNodePath, ICFGEdgePath}));
+        std::vector<const ICFGNode*> nodes;
         std::vector<const ICFGEdge*> edges;
         for (auto it = icfg->begin(); it != icfg->end(); ++it)
         {
             ICFGNode* node = it->second;
-            addICFGNode2db(connection, node, "ICFG");
+            if (isRowWritten("ICFG", node->getFun()))
+                nodes.push_back(node);
             for (auto edgeIter = node->OutEdgeBegin();
                  edgeIter != node->OutEdgeEnd(); ++edgeIter)
             {
+                // the edges into a function written again went with its nodes
                 ICFGEdge* edge = *edgeIter;
-                edges.push_back(edge);
+                if (isRowWritten("ICFG", edge->getSrcNode()->getFun()) ||
+                    isRowWritten("ICFG", edge->getDstNode()->getFun()))
+                    edges.push_back(edge);
             }
         }
-        for (auto edge : edges)
-        {
-            addICFGEdge2db(connection, edge, "ICFG");
-        }
+        addStmts2Writer(nodes, [this](const ICFGNode* node) { return getICFGNodeInsertStmt(node); },
+                        writer.get(), false);
+        writer->flush();
+        addStmts2Writer(edges, [this](const ICFGEdge* edge) { return getICFGEdgeInsertStmt(edge); },
+                        writer.get(), true);
+        writer->flush();
     }
 }
 
@@ -455,94 +1921,157 @@ void GraphDBClient::insertCallGraph2db(const CallGraph* callGraph)
     std::string callGraphEdgePath =
         std::string(WORKSPACE_DIR) +  "/src/DBSchema/CallGraphEdgeSchema.json";
     // add all CallGraph Node & Edge to DB
-    if (nullptr != connection)
+    if ((nullptr != connection || isOfflineMode()) && needsWrite("CallGraph"))
     {
-        // create a new graph name CallGraph in db
-        createSubGraph(connection, "CallGraph");
-        // load schema for CallGraph
-        SVF::GraphDBClient::getInstance().loadSchema(
-            connection,
-            callGraphEdgePath,
-            "CallGraph");
-        SVF::GraphDBClient::getInstance().loadSchema(
-            connection,
-            callGraphNodePath,
-            "CallGraph");
+        // create a new graph name CallGraph in db and load schema for CallGraph
+        std::unique_ptr<DBBatchWriter> writer(createGraphWriter("CallGraph", {callGraphEdgePath, callGraphNodePath}));
+        std::vector<const CallGraphNode*> nodes;
         std::vector<const CallGraphEdge*> edges;
         for (const auto& item : *callGraph)
         {
             const CallGraphNode* node = item.second;
-            addCallGraphNode2db(connection, node, "CallGraph");
+            if (isRowWritten("CallGraph", node->getFunction()))
+                nodes.push_back(node);
             for (CallGraphEdge::CallGraphEdgeSet::iterator iter =
                      node->OutEdgeBegin();
                  iter != node->OutEdgeEnd(); ++iter)
             {
                 const CallGraphEdge* edge = *iter;
-                edges.push_back(edge);
+                if (isRowWritten("CallGraph", edge->getSrcNode()->getFunction()) ||
+                    isRowWritten("CallGraph", edge->getDstNode()->getFunction()))
+                    edges.push_back(edge);
             }
         }
-        for (const auto& edge : edges)
-        {
-            addCallGraphEdge2db(connection, edge, "CallGraph");
-        }
+        // the nodes keep the content hash of their function for the next incremental write
+        addStmts2Writer(nodes, [this](const CallGraphNode* node)
+                        { return callGraphNode2DBString(node, nullptr != writePlan ? writePlan->getFunctionHash(node->getName()) : ""); },
+                        writer.get(), false);
+        writer->flush();
+        addStmts2Writer(edges, [this](const CallGraphEdge* edge) { return callGraphEdge2DBString(edge); },
+                        writer.get(), true);
+        writer->flush();
 
         } else {
         SVFUtil::outs() << "No DB connection, skip inserting CallGraph to DB\n";
         }
 }
 
+void GraphDBClient::updateIndCallEdges2db(const CallGraph* callGraph)
+{
+    if (nullptr == connection && !isOfflineMode())
+    {
+        return;
+    }
+    std::vector<const CallGraphEdge*> edges;
+    for (const auto& item : *callGraph)
+    {
+        for (auto iter = item.second->OutEdgeBegin(); iter != item.second->OutEdgeEnd(); ++iter)
+        {
+            if ((*iter)->isIndirectCallEdge())
+                edges.push_back(*iter);
+        }
+    }
+    // an edge is the same as one in DB if it has the same ends, kind and csid
+    std::vector<std::string> deleteStmts;
+    const size_t edgesPerStmt = std::max(DBBatchSize(), 1u);
+    for (size_t begin = 0; begin < edges.size(); begin += edgesPerStmt)
+    {
+        std::string keys = "";
+        for (size_t i = begin; i < std::min(edges.size(), begin + edgesPerStmt); ++i)
+        {
+            keys += (keys.empty() ? "[" : ", [") + std::to_string(edges[i]->getSrcID()) + ", "
+                    + std::to_string(edges[i]->getDstID()) + ", " + std::to_string(edges[i]->getEdgeKind()) + ", "
+                    + std::to_string(edges[i]->getCallSiteID()) + "]";
+        }
+        deleteStmts.push_back("UNWIND [" + keys + "] AS k MATCH (n:CallGraphNode{id:k[0]})-[e:CallGraphEdge]->(m:CallGraphNode{id:k[1]})"
+                              " WHERE e.kind = k[2] AND e.csid = k[3] DELETE e");
+    }
+    s64_t stamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::system_clock::now().time_since_epoch()).count();
+    std::string stampStmt = "MATCH (n:DBVersion) SET n.stamp = " + std::to_string(stamp);
+    if (isOfflineMode())
+    {
+        // the CallGraph is imported on its own, update it after its import
+        for (const std::string& stmt : deleteStmts)
+            DBOfflineWriter::appendPostImportStmt(Write2DBOfflineDir(), "CallGraph", stmt);
+        for (const CallGraphEdge* edge : edges)
+            DBOfflineWriter::appendPostImportStmt(Write2DBOfflineDir(), "CallGraph", callGraphEdge2DBString(edge));
+        DBOfflineWriter::appendPostImportStmt(Write2DBOfflineDir(), "CallGraph", stampStmt);
+    }
+    else
+    {
+        if (!DBSnapshotFile().empty())
+        {
+            DBSnapshot::invalidate(DBSnapshotFile());
+        }
+        DBBatchWriter writer(connection, "CallGraph", DBBatchSize());
+        for (const std::string& stmt : deleteStmts)
+            writer.addStmt(stmt);
+        writer.flush();
+        addStmts2Writer(edges, [this](const CallGraphEdge* edge) { return callGraphEdge2DBString(edge); },
+                        &writer, true);
+        writer.addStmt(stampStmt);
+        writer.flush();
+    }
+    {
+        std::lock_guard<std::mutex> lock(writtenStampsMtx);
+        writtenStamps["CallGraph"] = stamp;
+    }
+    SVFUtil::outs() << "Write " << edges.size() << " indirect call edges to the CallGraph graph\n";
+}
+
+std::string GraphDBClient::getSVFTypeInsertStmt(const SVFType* ty)
+{
+    std::string queryStatement = "";
+    if (const SVFPointerType* svfType = SVFUtil::dyn_cast<SVFPointerType>(ty))
+    {
+        queryStatement = SVFPointerType2DBString(svfType);
+    } 
+    else if (const SVFIntegerType* svfType = SVFUtil::dyn_cast<SVFIntegerType>(ty))
+    {
+        queryStatement = SVFIntegerType2DBString(svfType);
+    }
+    else if (const SVFFunctionType* svfType = SVFUtil::dyn_cast<SVFFunctionType>(ty))
+    {
+        queryStatement = SVFFunctionType2DBString(svfType);
+    }
+    else if (const SVFStructType* svfType = SVFUtil::dyn_cast<SVFStructType>(ty))
+    {
+        queryStatement = SVFStructType2DBString(svfType);
+    }
+    else if (const SVFArrayType* svfType = SVFUtil::dyn_cast<SVFArrayType>(ty))
+    {
+        queryStatement = SVFArrayType2DBString(svfType);
+    }
+    else if (const SVFOtherType* svfType = SVFUtil::dyn_cast<SVFOtherType>(ty))
+    {
+        queryStatement = SVFOtherType2DBString(svfType);
+    }
+    else 
+    {
+        assert("unknown SVF type?");
+    }
+    return queryStatement;
+}
+
 void GraphDBClient::insertSVFTypeNodeSet2db(const Set<const SVFType*>* types, const Set<const StInfo*>* stInfos, std::string& dbname)
 {
-    if (nullptr != connection)
+    if ((nullptr != connection || isOfflineMode()) && !isGraphPatched(dbname))
     {
-        // create a new graph name SVFType in db
-        createSubGraph(connection, "SVFType");
-        // load schema for SVFType
-        loadSchema(connection, std::string(WORKSPACE_DIR) +  "/src/DBSchema/SVFTypeNodeSchema.json", "SVFType");
-        
+        // create a new graph name SVFType in db and load schema for SVFType
+        std::unique_ptr<DBBatchWriter> writer(createGraphWriter(dbname,
+            {std::string(WORKSPACE_DIR) +  "/src/DBSchema/SVFTypeNodeSchema.json"}));
+
         // load & insert each svftype node to db
         for (const auto& ty : *types)
         {
-            std::string queryStatement;
-            if (const SVFPointerType* svfType = SVFUtil::dyn_cast<SVFPointerType>(ty))
-            {
-                queryStatement = SVFPointerType2DBString(svfType);
-            } 
-            else if (const SVFIntegerType* svfType = SVFUtil::dyn_cast<SVFIntegerType>(ty))
-            {
-                queryStatement = SVFIntegerType2DBString(svfType);
-            }
-            else if (const SVFFunctionType* svfType = SVFUtil::dyn_cast<SVFFunctionType>(ty))
-            {
-                queryStatement = SVFFunctionType2DBString(svfType);
-            }
-            else if (const SVFStructType* svfType = SVFUtil::dyn_cast<SVFStructType>(ty))
-            {
-                queryStatement = SVFStructType2DBString(svfType);
-            }
-            else if (const SVFArrayType* svfType = SVFUtil::dyn_cast<SVFArrayType>(ty))
-            {
-                queryStatement = SVFArrayType2DBString(svfType);
-            }
-            else if (const SVFOtherType* svfType = SVFUtil::dyn_cast<SVFOtherType>(ty))
-            {
-                queryStatement = SVFOtherType2DBString(svfType);
-            }
-            else 
+            std::string queryStatement = getSVFTypeInsertStmt(ty);
+            if (queryStatement.empty())
             {
-                assert("unknown SVF type?");
                 return ;
             }
-    
             // SVFUtil::outs()<<"SVFType Insert Query:"<<queryStatement<<"\n";
-            std::string result;
-            bool ret = connection->CallCypher(result, queryStatement, dbname);
-            if (!ret)
-            {
-                SVFUtil::outs() << "Warining: Failed to add SVFType node to db " << dbname << " "
-                                << result << "\n";
-            }
-        
+            writer->addNodeStmt(queryStatement);
         }
 
         // load & insert each stinfo node to db
@@ -551,27 +2080,22 @@ void GraphDBClient::insertSVFTypeNodeSet2db(const Set<const SVFType*>* types, co
             // insert stinfo node to db
             std::string queryStatement = stInfo2DBString(stInfo);
             // SVFUtil::outs()<<"StInfo Insert Query:"<<queryStatement<<"\n";
-            std::string result;
-            bool ret = connection->CallCypher(result, queryStatement, dbname);
-            if (!ret)
-            {
-                SVFUtil::outs() << "Warining: Failed to add StInfo node to db " << dbname << " "
-                                << result << "\n";
-            }
+            writer->addNodeStmt(queryStatement);
         }
+        writer->flush();
     }
 
 }
 
-void GraphDBClient::insertBasicBlockGraph2db(const BasicBlockGraph* bbGraph)
+void GraphDBClient::insertBasicBlockGraph2db(const BasicBlockGraph* bbGraph, DBBatchWriter* writer)
 {
-    if (nullptr != connection)
+    if (nullptr != writer)
     {
         std::vector<const BasicBlockEdge*> edges;
         for (auto& bb: *bbGraph)
         {
             SVFBasicBlock* node = bb.second;
-            insertBBNode2db(connection, node, "BasicBlockGraph");
+            writer->addNodeStmt(bb2DBString(node));
             for (auto iter = node->OutEdgeBegin(); iter != node->OutEdgeEnd(); ++iter)
             {
                 edges.push_back(*iter);
@@ -579,7 +2103,7 @@ void GraphDBClient::insertBasicBlockGraph2db(const BasicBlockGraph* bbGraph)
         }
         for (const BasicBlockEdge* edge : edges)
         {
-            insertBBEdge2db(connection, edge, "BasicBlockGraph");
+            writer->addEdgeStmt(bbEdge2DBString(edge));
         }
     }
 }
@@ -634,38 +2158,57 @@ void GraphDBClient::insertPAG2db(const PAG* pag)
         std::string(WORKSPACE_DIR) +  "/src/DBSchema/BasicBlockEdgeSchema.json";
 
     // add all PAG Node & Edge to DB
-    if (nullptr != connection)
-    {
-        // create a new graph name PAG in db
-        createSubGraph(connection, "PAG");
-        // create a new graph name BasicBlockGraph in db
-        createSubGraph(connection, "BasicBlockGraph");
-        // load schema for PAG
-        SVF::GraphDBClient::getInstance().loadSchema(connection, pagEdgePath,
-                                                     "PAG");
-        SVF::GraphDBClient::getInstance().loadSchema(connection, pagNodePath,
-                                                     "PAG");
-        // load schema for PAG
-        SVF::GraphDBClient::getInstance().loadSchema(connection, bbEdgePath,
-                                                     "BasicBlockGraph");
-        SVF::GraphDBClient::getInstance().loadSchema(connection, bbNodePath,
-                                                     "BasicBlockGraph");
-
+    if (nullptr != connection || isOfflineMode())
+    {
+        // create a new graph name PAG and BasicBlockGraph in db and load their schema;
+        // rows are serialized by DBThreads() producers and sent per label as UNWIND
+        // batches of DBBatchSize() rows over the connection pool, all nodes are
+        // committed before the edges which MATCH on them
+        // under -write2db-incremental a graph may need no write at all, and the
+        // PAG nodes belong to no function so a patched PAG keeps them
+        std::unique_ptr<DBBatchWriter> writer;
+        std::unique_ptr<DBBatchWriter> bbWriter;
+        if (needsWrite("PAG"))
+            writer.reset(createGraphWriter("PAG", {pagEdgePath, pagNodePath}));
+        if (needsWrite("BasicBlockGraph"))
+            bbWriter.reset(createGraphWriter("BasicBlockGraph", {bbEdgePath, bbNodePath}));
+        const bool writeNodes = nullptr != writer && !isGraphPatched("PAG");
+        std::vector<const SVFVar*> nodes;
         std::vector<const SVFStmt*> edges;
         for (auto it = pag->begin(); it != pag->end(); ++it)
         {
             SVFVar* node = it->second;
-            insertPAGNode2db(connection, node, "PAG");
+            if (writeNodes)
+                nodes.push_back(node);
+            if (const FunObjVar* funObjVar = SVFUtil::dyn_cast<FunObjVar>(node))
+            {
+                if (nullptr != bbWriter && nullptr != funObjVar->getBasicBlockGraph() &&
+                    isRowWritten("BasicBlockGraph", funObjVar))
+                {
+                    insertBasicBlockGraph2db(funObjVar->getBasicBlockGraph(), bbWriter.get());
+                }
+            }
             for (auto edgeIter = node->OutEdgeBegin();
                  edgeIter != node->OutEdgeEnd(); ++edgeIter)
             {
                 SVFStmt* edge = *edgeIter;
-                edges.push_back(edge);
+                if (nullptr != writer && isRowWritten("PAG", getFunOfRow(edge)))
+                    edges.push_back(edge);
             }
         }
-        for (auto edge : edges)
+        if (nullptr != writer)
         {
-            insertPAGEdge2db(connection, edge, "PAG");
+            addStmts2Writer(nodes, [this](const SVFVar* node) { return getPAGNodeInsertStmt(node); },
+                            writer.get(), false);
+            writer->flush();
+        }
+        if (nullptr != bbWriter)
+            bbWriter->flush();
+        if (nullptr != writer)
+        {
+            addStmts2Writer(edges, [this](const SVFStmt* edge) { return getPAGEdgeInsertStmt(edge); },
+                            writer.get(), true);
+            writer->flush();
         }
     }
     else
@@ -884,10 +2427,6 @@ std::string GraphDBClient::getPAGNodeInsertStmt(const SVFVar* node)
     else if(const FunObjVar* svfVar = SVFUtil::dyn_cast<FunObjVar>(node))
     {
         queryStatement = funObjVar2DBString(svfVar);
-        if ( nullptr != svfVar->getBasicBlockGraph())
-        {
-            insertBasicBlockGraph2db(svfVar->getBasicBlockGraph());
-        }
     }
     else if(const StackObjVar* svfVar = SVFUtil::dyn_cast<StackObjVar>(node))
     {
@@ -1041,7 +2580,7 @@ void GraphDBClient::readSVFTypesFromDB(lgraph::RpcClient* connection, const std:
 void GraphDBClient::addSVFTypeNodeFromDB(lgraph::RpcClient* connection, const std::string& dbname, SVFIR* pag)
 {
     // parse all SVFType
-    std::string queryStatement = "MATCH (node) WHERE NOT 'StInfo' IN labels(node) return node";
+    std::string queryStatement = "MATCH (node) WHERE NOT 'StInfo' IN labels(node) AND NOT 'DBVersion' IN labels(node) return node";
 
     Map<int, SVFType*> svfTypeMap;
     Map<int, StInfo*> stInfoMap;
@@ -1053,33 +2592,31 @@ void GraphDBClient::addSVFTypeNodeFromDB(lgraph::RpcClient* connection, const st
     Map<int, Set<SVFArrayType*>> elementTyepsMap;
     Map<SVFStructType*, std::vector<int>> structType2FieldsTypeIdMap;
     
-    cJSON* root = queryFromDB(connection, dbname, queryStatement);
-    cJSON* node;
+    DBResult* root = queryFromDB(connection, dbname, queryStatement);
     if (nullptr != root)
     {
-        cJSON_ArrayForEach(node, root)
+        for (const DBValue* node : *root)
         {
-            cJSON* data = cJSON_GetObjectItem(node, "node");
+            const DBValue* data = node->get(DB_FIELD("node"));
             if (!data)
                 continue;
 
-            cJSON* properties = cJSON_GetObjectItem(data, "properties");
+            const DBValue* properties = data->get(DB_FIELD("properties"));
             if (!properties)
                 continue;
 
-            std::string label = cJSON_GetObjectItem(data, "label")->valuestring;
+            std::string label = data->getString(DB_FIELD("label"));
 
             SVFType* type = nullptr;
             int i8Type =
-                cJSON_GetObjectItem(properties, "svf_i8_type_id")->valueint;
+                properties->getInt(DB_FIELD("svf_i8_type_id"));
             int ptrType =
-                cJSON_GetObjectItem(properties, "svf_ptr_type_id")->valueint;
-            bool svt = cJSON_IsTrue(
-                cJSON_GetObjectItem(properties, "is_single_val_ty"));
+                properties->getInt(DB_FIELD("svf_ptr_type_id"));
+            bool svt = properties->getBool(DB_FIELD("is_single_val_ty"));
             int byteSize =
-                cJSON_GetObjectItem(properties, "byte_size")->valueint;
+                properties->getInt(DB_FIELD("byte_size"));
             int typeId =
-                cJSON_GetObjectItem(properties, "id")->valueint;
+                properties->getInt(DB_FIELD("id"));
 
             if (label == "SVFPointerType")
             {
@@ -1087,21 +2624,19 @@ void GraphDBClient::addSVFTypeNodeFromDB(lgraph::RpcClient* connection, const st
             }
             else if (label == "SVFIntegerType")
             {
-                cJSON* single_and_width_Json =
-                    cJSON_GetObjectItem(properties, "single_and_width");
                 short single_and_width =
-                    (short)cJSON_GetNumberValue(single_and_width_Json);
+                    (short)properties->getDouble(DB_FIELD("single_and_width"));
                 SVFIntegerType* integerType = new SVFIntegerType(typeId, byteSize);
                 type = integerType;
                 integerType->setSignAndWidth(single_and_width);
             }
             else if (label == "SVFFunctionType")
             {
-                bool isvararg = cJSON_IsTrue(cJSON_GetObjectItem(properties, "is_single_val_ty"));
+                bool isvararg = properties->getBool(DB_FIELD("is_single_val_ty"));
                 std::vector<const SVFType*> emptyTypes;
                 SVFFunctionType* funType = new SVFFunctionType(typeId, nullptr, emptyTypes, isvararg);
                 type = funType;
-                int retTypeId = cJSON_GetObjectItem(properties, "ret_ty_node_id") ->valueint;
+                int retTypeId = properties->getInt(DB_FIELD("ret_ty_node_id"));
                 auto it = svfTypeMap.find(retTypeId);
                 if (it != svfTypeMap.end())
                 {
@@ -1111,7 +2646,7 @@ void GraphDBClient::addSVFTypeNodeFromDB(lgraph::RpcClient* connection, const st
                 {
                     functionRetTypeSetMap[retTypeId].insert(funType);
                 }
-                std::string paramsTypes = cJSON_GetObjectItem(properties, "params_types_vec")->valuestring;
+                std::string paramsTypes = properties->getString(DB_FIELD("params_types_vec"));
                 if (!paramsTypes.empty())
                 {
                     functionParamsTypeSetMap[funType] = parseSVFTypes(paramsTypes);
@@ -1120,24 +2655,24 @@ void GraphDBClient::addSVFTypeNodeFromDB(lgraph::RpcClient* connection, const st
             else if (label == "SVFOtherType")
             {
                 std::string repr =
-                    cJSON_GetObjectItem(properties, "repr")->valuestring;
+                    properties->getString(DB_FIELD("repr"));
                 SVFOtherType* otherType = new SVFOtherType(typeId, svt, byteSize);
                 type = otherType;
                 otherType->setRepr(repr);
             }
             else if (label == "SVFStructType")
             {
-                std::string name = cJSON_GetObjectItem(properties, "struct_name")->valuestring;
+                std::string name = properties->getString(DB_FIELD("struct_name"));
                 std::vector<const SVFType*> emptyTypes;
                 SVFStructType* structType = new SVFStructType(typeId, emptyTypes, byteSize);
                 type = structType;
                 structType->setName(name);
-                std::string fieldTypesStr = cJSON_GetObjectItem(properties, "fields_id_vec")->valuestring;
+                std::string fieldTypesStr = properties->getString(DB_FIELD("fields_id_vec"));
                 if (!fieldTypesStr.empty())
                 {
                     structType2FieldsTypeIdMap[structType] = parseSVFTypes(fieldTypesStr);
                 }
-                int stInfoID = cJSON_GetObjectItem(properties, "stinfo_node_id")->valueint;
+                int stInfoID = properties->getInt(DB_FIELD("stinfo_node_id"));
                 auto it = stInfoMap.find(stInfoID);
                 if (it != stInfoMap.end())
                 {
@@ -1150,11 +2685,11 @@ void GraphDBClient::addSVFTypeNodeFromDB(lgraph::RpcClient* connection, const st
             }
             else if (label == "SVFArrayType")
             {
-                int numOfElement = cJSON_GetObjectItem(properties, "num_of_element")->valueint;
+                int numOfElement = properties->getInt(DB_FIELD("num_of_element"));
                 SVFArrayType* arrayType = new SVFArrayType(typeId, byteSize);
                 arrayType->setNumOfElement(numOfElement);
                 type = arrayType;
-                int stInfoID = cJSON_GetObjectItem(properties, "stinfo_node_id")->valueint;
+                int stInfoID = properties->getInt(DB_FIELD("stinfo_node_id"));
                 auto stInfoIter = stInfoMap.find(stInfoID);
                 if (stInfoIter != stInfoMap.end())
                 {
@@ -1164,7 +2699,7 @@ void GraphDBClient::addSVFTypeNodeFromDB(lgraph::RpcClient* connection, const st
                 {
                     stInfoId2SVFTypeMap[stInfoID].insert(type);
                 }
-                int typeOfElementId = cJSON_GetObjectItem(properties,"type_of_element_node_type_id")->valueint;
+                int typeOfElementId = properties->getInt(DB_FIELD("type_of_element_node_type_id"));
                 auto tyepIter = svfTypeMap.find(typeOfElementId);
                 if (tyepIter != svfTypeMap.end())
                 {
@@ -1179,7 +2714,7 @@ void GraphDBClient::addSVFTypeNodeFromDB(lgraph::RpcClient* connection, const st
             // svfTypeKind2SVFTypesMap[type->getSVFTyKind()].insert(type);
             svfi8AndPtrTypeMap[type] = std::make_pair(i8Type, ptrType);
         }
-        cJSON_Delete(root);
+        delete root;
     }
 
     // parse all StInfo
@@ -1187,38 +2722,38 @@ void GraphDBClient::addSVFTypeNodeFromDB(lgraph::RpcClient* connection, const st
     root = queryFromDB(connection, dbname, queryStatement);
     if (nullptr != root)
     {
-        cJSON_ArrayForEach(node, root)
+        for (const DBValue* node : *root)
         {
-            cJSON* data = cJSON_GetObjectItem(node, "node");
+            const DBValue* data = node->get(DB_FIELD("node"));
             if (!data)
                 continue;
 
-            cJSON* properties = cJSON_GetObjectItem(data, "properties");
+            const DBValue* properties = data->get(DB_FIELD("properties"));
             if (!properties)
                 continue;
 
-            u32_t id = static_cast<u32_t>(cJSON_GetObjectItem(properties, "st_info_id")->valueint);
-            std::string fld_idx_vec = cJSON_GetObjectItem(properties, "fld_idx_vec")->valuestring;
+            u32_t id = static_cast<u32_t>(properties->getInt(DB_FIELD("st_info_id")));
+            std::string fld_idx_vec = properties->getString(DB_FIELD("fld_idx_vec"));
             std::vector<u32_t> fldIdxVec = parseElements2Container<std::vector<u32_t>>(fld_idx_vec);
 
-            std::string elem_idx_vec = cJSON_GetObjectItem(properties, "elem_idx_vec")->valuestring;
+            std::string elem_idx_vec = properties->getString(DB_FIELD("elem_idx_vec"));
             std::vector<u32_t> elemIdxVec = parseElements2Container<std::vector<u32_t>>(elem_idx_vec);
 
-            std::string fld_idx_2_type_map = cJSON_GetObjectItem(properties, "fld_idx_2_type_map")->valuestring;
+            std::string fld_idx_2_type_map = properties->getString(DB_FIELD("fld_idx_2_type_map"));
             Map<u32_t, const SVFType*> fldIdx2TypeMap = parseStringToFldIdx2TypeMap<Map<u32_t, const SVFType*>>(fld_idx_2_type_map, svfTypeMap);
 
-            std::string finfo_types = cJSON_GetObjectItem(properties, "finfo_types")->valuestring;
+            std::string finfo_types = properties->getString(DB_FIELD("finfo_types"));
             std::vector<const SVFType*> finfo = parseElementsToSVFTypeContainer<std::vector<const SVFType*>>(finfo_types, svfTypeMap);
 
-            u32_t stride = static_cast<u32_t>(cJSON_GetObjectItem(properties, "stride")->valueint);
-            u32_t num_of_flatten_elements = static_cast<u32_t>(cJSON_GetObjectItem(properties, "num_of_flatten_elements")->valueint);
-            u32_t num_of_flatten_fields = static_cast<u32_t>(cJSON_GetObjectItem(properties, "num_of_flatten_fields")->valueint);
-            std::string flatten_element_types =cJSON_GetObjectItem(properties, "flatten_element_types")->valuestring;
+            u32_t stride = static_cast<u32_t>(properties->getInt(DB_FIELD("stride")));
+            u32_t num_of_flatten_elements = static_cast<u32_t>(properties->getInt(DB_FIELD("num_of_flatten_elements")));
+            u32_t num_of_flatten_fields = static_cast<u32_t>(properties->getInt(DB_FIELD("num_of_flatten_fields")));
+            std::string flatten_element_types =properties->getString(DB_FIELD("flatten_element_types"));
             std::vector<const SVFType*> flattenElementTypes =parseElementsToSVFTypeContainer<std::vector<const SVFType*>>(flatten_element_types, svfTypeMap);
             StInfo* stInfo =new StInfo(id, fldIdxVec, elemIdxVec, fldIdx2TypeMap, finfo,stride, num_of_flatten_elements,num_of_flatten_fields, flattenElementTypes);
             stInfoMap[id] = stInfo;
         }
-        cJSON_Delete(root);
+        delete root;
     }
 
     for (auto& [retTypeId, types]:functionRetTypeSetMap)
@@ -1338,72 +2873,98 @@ void GraphDBClient::addSVFTypeNodeFromDB(lgraph::RpcClient* connection, const st
 
 void GraphDBClient::updateRetPE4RetCFGEdge()
 {
-    if (retCFGEdge2RetPEStrMap.size() > 0)
+    DBLoadSession& refs = getLoadSession();
+    // an edge is dropped once resolved; under -db-entry its RetPE may belong
+    // to a function which is not loaded yet, it is then kept for a later load
+    for (auto it = refs.retCFGEdge2RetPEStrMap.begin(); it != refs.retCFGEdge2RetPEStrMap.end();)
     {
-        for (auto& [edge, id] : retCFGEdge2RetPEStrMap)
+        RetCFGEdge* edge = it->first;
+        int id = it->second;
+        if (nullptr != edge && id != -1)
         {
-            if (nullptr != edge && id != -1)
+            RetPE* retPE = getLoadSession().id2RetPEMap.find(id);
+            if (nullptr != retPE)
             {
-                auto it = id2RetPEMap.find(id);
-                if (it != id2RetPEMap.end())
-                {
-                    RetPE* retPE = it->second;
-                    edge->addRetPE(retPE);
-                }
-                else
-                {
-                    SVFUtil::outs() << "Warning[updateRetPE4RetCFGEdge]: No matching RetPE found for id: " << id << "\n";
-                }
+                edge->addRetPE(retPE);
+            }
+            else if (DBLazyLoad())
+            {
+                ++it;
+                continue;
+            }
+            else
+            {
+                SVFUtil::outs() << "Warning[updateRetPE4RetCFGEdge]: No matching RetPE found for id: " << id << "\n";
             }
         }
+        it = refs.retCFGEdge2RetPEStrMap.erase(it);
     }
 }
 
 void GraphDBClient::updateCallPEs4CallCFGEdge()
 {
-    if (callCFGEdge2CallPEStrMap.size() > 0)
+    DBLoadSession& refs = getLoadSession();
+    for (auto it = refs.callCFGEdge2CallPEStrMap.begin(); it != refs.callCFGEdge2CallPEStrMap.end();)
     {
-        for (auto& [edge, ids] : callCFGEdge2CallPEStrMap)
+        CallCFGEdge* edge = it->first;
+        std::vector<int> pendingIds;
+        if (nullptr != edge && !it->second.empty())
         {
-            if (nullptr != edge && !ids.empty())
+            std::vector<int> idVec = parseElements2Container<std::vector<int>>(it->second);
+            for (int id : idVec)
             {
-                std::vector<int> idVec = parseElements2Container<std::vector<int>>(ids);
-                for (int id : idVec)
+                CallPE* callPE = getLoadSession().id2CallPEMap.find(id);
+                if (nullptr != callPE)
                 {
-                    auto it = id2CallPEMap.find(id);
-                    if (it != id2CallPEMap.end())
-                    {
-                        CallPE* callPE = it->second;
-                        edge->addCallPE(callPE);
-                    }
-                    else
-                    {
-                        SVFUtil::outs() << "Warning[updateCallPEs4CallCFGEdge]: No matching CallPE found for id: " << id << "\n";
-                    }
+                    edge->addCallPE(callPE);
+                }
+                else if (DBLazyLoad())
+                {
+                    pendingIds.push_back(id);
+                }
+                else
+                {
+                    SVFUtil::outs() << "Warning[updateCallPEs4CallCFGEdge]: No matching CallPE found for id: " << id << "\n";
                 }
             }
         }
+        if (pendingIds.empty())
+        {
+            it = refs.callCFGEdge2CallPEStrMap.erase(it);
+        }
+        else
+        {
+            it->second = extractIdxs(pendingIds);
+            ++it;
+        }
     }
 }
 
 void GraphDBClient::loadSVFPAGEdgesFromDB(lgraph::RpcClient* connection, const std::string& dbname, SVFIR* pag)
 {
+    DBLoadSession& session = getLoadSession();
     SVFUtil::outs()<< "Loading SVF PAG edges from DB....\n";
-    readPAGEdgesFromDB(connection, dbname, "AddrStmt", pag);
-    readPAGEdgesFromDB(connection, dbname, "CopyStmt", pag);
-    readPAGEdgesFromDB(connection, dbname, "StoreStmt", pag);
-    readPAGEdgesFromDB(connection, dbname, "LoadStmt", pag);
-    readPAGEdgesFromDB(connection, dbname, "GepStmt", pag);
-    readPAGEdgesFromDB(connection, dbname, "CallPE", pag);
-    readPAGEdgesFromDB(connection, dbname, "RetPE", pag);
-    readPAGEdgesFromDB(connection, dbname, "PhiStmt", pag);
-    readPAGEdgesFromDB(connection, dbname, "SelectStmt", pag);
-    readPAGEdgesFromDB(connection, dbname, "CmpStmt", pag);
-    readPAGEdgesFromDB(connection, dbname, "BinaryOPStmt", pag);
-    readPAGEdgesFromDB(connection, dbname, "UnaryOPStmt", pag);
-    readPAGEdgesFromDB(connection, dbname, "BranchStmt", pag);
-    readPAGEdgesFromDB(connection, dbname, "TDForkPE", pag);
-    readPAGEdgesFromDB(connection, dbname, "RetPETDJoinPE", pag);
+    const u32_t numOfEdges = readRowCountFromDB(connection, dbname, pagEdgeTypes, true);
+    session.edgeId2SVFStmtMap.reserve(numOfEdges);
+    session.id2CallPEMap.reserve(numOfEdges);
+    session.id2RetPEMap.reserve(numOfEdges);
+    if (DBLazyLoad())
+    {
+        // only the stmts outside of any function body: those without an ICFG
+        // node and those of the GlobalICFGNode
+        readLabelsFromDB(connection, dbname, pagEdgeTypes, "edge", {"edge.edge_id"},
+                         [](const std::string& edgeType)
+                         { return "MATCH ()-[edge:" + edgeType + "]->() WHERE edge.icfg_node_id = -1 WITH edge"; },
+                         [this, pag](DBPageReader& reader, const std::string& edgeType)
+                         { readPAGEdgesFromDB(reader, edgeType, pag); });
+        loadSVFStmtsOfICFGNodesFromDB(connection, dbname, pag);
+        SVFUtil::outs()<< "Loading SVF PAG edges from DB done....\n";
+        return;
+    }
+    readLabelsFromDB(connection, dbname, pagEdgeTypes, "edge", {"edge.edge_id"},
+                     [](const std::string& edgeType) { return "MATCH ()-[edge:" + edgeType + "]->()"; },
+                     [this, pag](DBPageReader& reader, const std::string& edgeType)
+                     { readPAGEdgesFromDB(reader, edgeType, pag); });
     
     updateCallPEs4CallCFGEdge();
     updateRetPE4RetCFGEdge();
@@ -1413,34 +2974,74 @@ void GraphDBClient::loadSVFPAGEdgesFromDB(lgraph::RpcClient* connection, const s
 
 void GraphDBClient::readPAGEdgesFromDB(lgraph::RpcClient* connection, const std::string& dbname, std::string edgeType, SVFIR* pag)
 {
-    int skip = 0;
-    int limit = 1000;
+    DBPageReader reader(connection, dbname, "MATCH ()-[edge:"+edgeType+"]->()", "edge", {"edge.edge_id"});
+    readPAGEdgesFromDB(reader, edgeType, pag);
+}
+
+void GraphDBClient::loadSVFStmtsOfICFGNodesFromDB(lgraph::RpcClient* connection, const std::string& dbname, SVFIR* pag)
+{
+    DBLoadSession& refs = getLoadSession();
+    // edge_id is indexed, so the stmts are looked up by their ids, up to a page
+    // of ids per query; ids read before (e.g. without ICFG node) are skipped
+    const u32_t idsPerQuery = std::max(DBPageSize(), 1u);
+    std::vector<std::string> idLists;
+    std::string idList = "";
+    u32_t numOfIds = 0;
+    for (auto& item : refs.icfgNode2StmtsStrMap)
+    {
+        std::vector<int> stmtIds = parseElements2Container<std::vector<int>>(item.second);
+        for (int stmtId : stmtIds)
+        {
+            if (nullptr != getLoadSession().edgeId2SVFStmtMap.find(stmtId))
+                continue;
+            idList += (idList.empty() ? "" : ", ") + std::to_string(stmtId);
+            if (++numOfIds % idsPerQuery == 0)
+            {
+                idLists.push_back(idList);
+                idList = "";
+            }
+        }
+    }
+    if (!idList.empty())
+    {
+        idLists.push_back(idList);
+    }
+    for (const std::string& ids : idLists)
+    {
+        readLabelsFromDB(connection, dbname, pagEdgeTypes, "edge", {"edge.edge_id"},
+                         [&ids](const std::string& edgeType)
+                         { return "MATCH ()-[edge:" + edgeType + "]->() WHERE edge.edge_id IN [" + ids + "] WITH edge"; },
+                         [this, pag](DBPageReader& reader, const std::string& edgeType)
+                         { readPAGEdgesFromDB(reader, edgeType, pag); });
+    }
+}
+
+void GraphDBClient::readPAGEdgesFromDB(DBPageReader& reader, std::string edgeType, SVFIR* pag)
+{
+    DBLoadSession& session = getLoadSession();
     while (true)
     {
-        // SVFUtil::outs() << "Loading SVF PAG edges from DB, edge type: " << edgeType << ", skip: " << skip << ", limit: " << limit << "\n";
-        std::string queryStatement =  "MATCH ()-[edge:"+edgeType+"]->() RETURN edge SKIP "+std::to_string(skip)+" LIMIT "+std::to_string(limit);
-        cJSON* root = queryFromDB(connection, dbname, queryStatement);
+        DBResult* root = reader.next();
         if ( nullptr == root)
         {
             break;
         }
         else
         {
-            cJSON* edge;
-            cJSON_ArrayForEach(edge, root)
+            for (const DBValue* edge : *root)
             {
-                cJSON* data = cJSON_GetObjectItem(edge, "edge");
+                const DBValue* data = edge->get(DB_FIELD("edge"));
                 if (!data)
                     continue;
-                cJSON* properties = cJSON_GetObjectItem(data, "properties");
+                const DBValue* properties = data->get(DB_FIELD("properties"));
                 if (!properties)
                     continue;
     
                 // parse src SVFVar & dst SVFVar
-                int src_id = cJSON_GetObjectItem(data,"src")->valueint;
-                int dst_id = cJSON_GetObjectItem(data,"dst")->valueint;
-                SVFVar* srcNode = pag->getGNode(src_id);
-                SVFVar* dstNode = pag->getGNode(dst_id);
+                int src_id = data->getInt(DB_FIELD("src"));
+                int dst_id = data->getInt(DB_FIELD("dst"));
+                SVFVar* srcNode = session.id2SVFVarMap.find(src_id);
+                SVFVar* dstNode = session.id2SVFVarMap.find(dst_id);
                 if (nullptr == srcNode)
                 {
                     SVFUtil::outs() << "Warning: [readPAGEdgesFromDB] No matching src SVFVar found for id: " << src_id << "\n";
@@ -1452,28 +3053,28 @@ void GraphDBClient::readPAGEdgesFromDB(lgraph::RpcClient* connection, const std:
                     continue;
                 }
     
-                int edge_id = cJSON_GetObjectItem(properties,"edge_id")->valueint;
-                int svf_var_node_id = cJSON_GetObjectItem(properties,"svf_var_node_id")->valueint; 
+                int edge_id = properties->getInt(DB_FIELD("edge_id"));
+                int svf_var_node_id = properties->getInt(DB_FIELD("svf_var_node_id")); 
                 SVFVar* value = nullptr;
                 if (svf_var_node_id != -1)
                 {
-                    value = pag->getGNode(svf_var_node_id);
+                    value = session.id2SVFVarMap.find(svf_var_node_id);
                 }
-                int icfg_node_id = cJSON_GetObjectItem(properties,"icfg_node_id")->valueint;
+                int icfg_node_id = properties->getInt(DB_FIELD("icfg_node_id"));
                 ICFGNode* icfgNode = nullptr;
                 if (icfg_node_id != -1)
                 {
                     icfgNode = pag->getICFG()->getICFGNode(icfg_node_id);
                 }
     
-                std::string bb_id = cJSON_GetObjectItem(properties,"bb_id")->valuestring;
+                std::string bb_id = properties->getString(DB_FIELD("bb_id"));
                 SVFBasicBlock* bb = nullptr;
                 if (!bb_id.empty())
                 {
                     std::pair<int, int> pair = parseBBIdPair(bb_id);
                     if (pair.first != -1 && pair.second != -1)
                     {
-                        FunObjVar* fun = SVFUtil::dyn_cast<FunObjVar>(pag->getGNode(pair.first));
+                        FunObjVar* fun = session.id2funObjVarsMap.find(pair.first);
                         if (nullptr != fun)
                         {
                             bb = fun->getBasicBlockGraph()->getGNode(pair.second);
@@ -1486,10 +3087,10 @@ void GraphDBClient::readPAGEdgesFromDB(lgraph::RpcClient* connection, const std:
                     }
                 }
     
-                int call_edge_label_counter = cJSON_GetObjectItem(properties,"call_edge_label_counter")->valueint; 
-                int store_edge_label_counter = cJSON_GetObjectItem(properties,"store_edge_label_counter")->valueint; 
-                int multi_opnd_label_counter = cJSON_GetObjectItem(properties,"multi_opnd_label_counter")->valueint; 
-                s64_t edgeFlag = static_cast<u64_t>(cJSON_GetObjectItem(properties,"edge_flag")->valueint);
+                int call_edge_label_counter = properties->getInt(DB_FIELD("call_edge_label_counter")); 
+                int store_edge_label_counter = properties->getInt(DB_FIELD("store_edge_label_counter")); 
+                int multi_opnd_label_counter = properties->getInt(DB_FIELD("multi_opnd_label_counter")); 
+                s64_t edgeFlag = static_cast<u64_t>(properties->getInt(DB_FIELD("edge_flag")));
     
                 SVFStmt* stmt = nullptr;
     
@@ -1499,14 +3100,14 @@ void GraphDBClient::readPAGEdgesFromDB(lgraph::RpcClient* connection, const std:
                     stmt->edgeId = edge_id;
                     stmt->value = value;
                     stmt->icfgNode = icfgNode;
-                    std::string arr_size = cJSON_GetObjectItem(properties,"arr_size")->valuestring;
+                    std::string arr_size = properties->getString(DB_FIELD("arr_size"));
                     AddrStmt* addrStmt = SVFUtil::cast<AddrStmt>(stmt);
                     if (!arr_size.empty())
                     {
                         Set<int> arrSizeVec = parseElements2Container<Set<int>>(arr_size);
                         for (int varId : arrSizeVec)
                         {
-                            SVFVar* var = pag->getGNode(varId);
+                            SVFVar* var = session.id2SVFVarMap.find(varId);
                             if (nullptr != var)
                             {
                                 addrStmt->addArrSize(var);
@@ -1524,7 +3125,7 @@ void GraphDBClient::readPAGEdgesFromDB(lgraph::RpcClient* connection, const std:
                 }
                 else if (edgeType == "CopyStmt")
                 {
-                    int copy_kind = cJSON_GetObjectItem(properties,"copy_kind")->valueint; 
+                    int copy_kind = properties->getInt(DB_FIELD("copy_kind")); 
                     stmt = new CopyStmt(srcNode, dstNode, static_cast<SVF::CopyStmt::CopyKind>(copy_kind));
                     stmt->edgeId = edge_id;
                     stmt->value = value;
@@ -1560,13 +3161,13 @@ void GraphDBClient::readPAGEdgesFromDB(lgraph::RpcClient* connection, const std:
                 }
                 else if (edgeType == "GepStmt")
                 {
-                    s64_t fldIdx = cJSON_GetObjectItem(properties, "ap_fld_idx")->valueint;
+                    s64_t fldIdx = properties->getInt(DB_FIELD("ap_fld_idx"));
                     if (fldIdx == -1)
                     {
                         fldIdx = 0;
                     }
-                    bool variant_field = cJSON_IsTrue(cJSON_GetObjectItem(properties,"variant_field"));
-                    int ap_gep_pointee_type_id = cJSON_GetObjectItem(properties, "ap_gep_pointee_type_id")->valueint;
+                    bool variant_field = properties->getBool(DB_FIELD("variant_field"));
+                    int ap_gep_pointee_type_id = properties->getInt(DB_FIELD("ap_gep_pointee_type_id"));
                     const SVFType* gepPointeeType = nullptr;
                     if (ap_gep_pointee_type_id != -1)
                     {
@@ -1583,7 +3184,7 @@ void GraphDBClient::readPAGEdgesFromDB(lgraph::RpcClient* connection, const std:
                         if (ap_gep_pointee_type_id != -1)
                             SVFUtil::outs() << "Warning: [readPAGEdgesFromDB] No matching SVFType found for ap_gep_pointee_type_id: " << ap_gep_pointee_type_id << " when updating GepStmt:"<<edge_id<< "\n";
                     }
-                    cJSON* ap_idx_operand_pairs_node = cJSON_GetObjectItem(properties, "ap_idx_operand_pairs");
+                    const DBValue* ap_idx_operand_pairs_node = properties->get(DB_FIELD("ap_idx_operand_pairs"));
                     std::string ap_idx_operand_pairs = "";
                     if (nullptr != ap_idx_operand_pairs_node && nullptr != ap_idx_operand_pairs_node->valuestring)
                     {
@@ -1603,8 +3204,8 @@ void GraphDBClient::readPAGEdgesFromDB(lgraph::RpcClient* connection, const std:
                 }
                 else if (edgeType == "CallPE")
                 {
-                    int call_icfg_node_id = cJSON_GetObjectItem(properties,"call_icfg_node_id")->valueint;
-                    int fun_entry_icfg_node_id = cJSON_GetObjectItem(properties,"fun_entry_icfg_node_id")->valueint;
+                    int call_icfg_node_id = properties->getInt(DB_FIELD("call_icfg_node_id"));
+                    int fun_entry_icfg_node_id = properties->getInt(DB_FIELD("fun_entry_icfg_node_id"));
                     const CallICFGNode* callICFGNode = nullptr;
                     const FunEntryICFGNode* funEntryICFGNode = nullptr;
                     if (call_icfg_node_id != -1)
@@ -1634,12 +3235,12 @@ void GraphDBClient::readPAGEdgesFromDB(lgraph::RpcClient* connection, const std:
                     {
                         pag->addCallPE(callPE, srcNode, dstNode);
                     }
-                    id2CallPEMap[edge_id] = callPE;
+                    session.id2CallPEMap.set(edge_id, callPE);
                 }
                 else if (edgeType == "TDForkPE")
                 {
-                    int call_icfg_node_id = cJSON_GetObjectItem(properties,"call_icfg_node_id")->valueint;
-                    int fun_entry_icfg_node_id = cJSON_GetObjectItem(properties,"fun_entry_icfg_node_id")->valueint;
+                    int call_icfg_node_id = properties->getInt(DB_FIELD("call_icfg_node_id"));
+                    int fun_entry_icfg_node_id = properties->getInt(DB_FIELD("fun_entry_icfg_node_id"));
                     const CallICFGNode* callICFGNode = nullptr;
                     const FunEntryICFGNode* funEntryICFGNode = nullptr;
                     if (call_icfg_node_id != -1)
@@ -1669,12 +3270,12 @@ void GraphDBClient::readPAGEdgesFromDB(lgraph::RpcClient* connection, const std:
                     {
                         pag->addCallPE(forkPE, srcNode, dstNode);
                     }
-                    id2CallPEMap[edge_id] = forkPE;
+                    session.id2CallPEMap.set(edge_id, forkPE);
                 }
                 else if (edgeType == "RetPE")
                 {
-                    int call_icfg_node_id = cJSON_GetObjectItem(properties,"call_icfg_node_id")->valueint;
-                    int fun_exit_icfg_node_id = cJSON_GetObjectItem(properties,"fun_exit_icfg_node_id")->valueint;
+                    int call_icfg_node_id = properties->getInt(DB_FIELD("call_icfg_node_id"));
+                    int fun_exit_icfg_node_id = properties->getInt(DB_FIELD("fun_exit_icfg_node_id"));
                     const CallICFGNode* callICFGNode = nullptr;
                     const FunExitICFGNode* funExitICFGNode = nullptr;
                     if (call_icfg_node_id != -1)
@@ -1704,12 +3305,12 @@ void GraphDBClient::readPAGEdgesFromDB(lgraph::RpcClient* connection, const std:
                     {
                         pag->addRetPE(retPE, srcNode, dstNode);
                     }
-                    id2RetPEMap[edge_id] = retPE;
+                    session.id2RetPEMap.set(edge_id, retPE);
                 }
                 else if (edgeType == "RetPETDJoinPE")
                 {
-                    int call_icfg_node_id = cJSON_GetObjectItem(properties,"call_icfg_node_id")->valueint;
-                    int fun_exit_icfg_node_id = cJSON_GetObjectItem(properties,"fun_exit_icfg_node_id")->valueint;
+                    int call_icfg_node_id = properties->getInt(DB_FIELD("call_icfg_node_id"));
+                    int fun_exit_icfg_node_id = properties->getInt(DB_FIELD("fun_exit_icfg_node_id"));
                     const CallICFGNode* callICFGNode = nullptr;
                     const FunExitICFGNode* funExitICFGNode = nullptr;
                     if (call_icfg_node_id != -1)
@@ -1739,15 +3340,15 @@ void GraphDBClient::readPAGEdgesFromDB(lgraph::RpcClient* connection, const std:
                     {
                         pag->addRetPE(joinPE, srcNode, dstNode);
                     }
-                    id2RetPEMap[edge_id] = joinPE;
+                    session.id2RetPEMap.set(edge_id, joinPE);
                 }
                 else if (edgeType == "PhiStmt")
                 {
                     std::vector<SVFVar*> opVarNodes;
-                    std::string op_var_node_ids = cJSON_GetObjectItem(properties, "op_var_node_ids")->valuestring;
+                    std::string op_var_node_ids = properties->getString(DB_FIELD("op_var_node_ids"));
                     parseOpVarString(op_var_node_ids, pag, opVarNodes);
                     std::vector<const ICFGNode*> opICFGNodes;
-                    std::string op_icfg_nodes_ids = cJSON_GetObjectItem(properties, "op_icfg_nodes_ids")->valuestring;
+                    std::string op_icfg_nodes_ids = properties->getString(DB_FIELD("op_icfg_nodes_ids"));
                     if (!op_icfg_nodes_ids.empty())
                     {
                         std::vector<int> opICFGNodeIds = parseElements2Container<std::vector<int>>(op_icfg_nodes_ids);
@@ -1778,10 +3379,10 @@ void GraphDBClient::readPAGEdgesFromDB(lgraph::RpcClient* connection, const std:
                 else if (edgeType == "SelectStmt")
                 {
                     std::vector<SVFVar*> opVarNodes;
-                    std::string op_var_node_ids = cJSON_GetObjectItem(properties, "op_var_node_ids")->valuestring;
+                    std::string op_var_node_ids = properties->getString(DB_FIELD("op_var_node_ids"));
                     parseOpVarString(op_var_node_ids, pag, opVarNodes);
-                    int condition_svf_var_node_id = cJSON_GetObjectItem(properties, "condition_svf_var_node_id")->valueint;
-                    SVFVar* condition = pag->getGNode(condition_svf_var_node_id);
+                    int condition_svf_var_node_id = properties->getInt(DB_FIELD("condition_svf_var_node_id"));
+                    SVFVar* condition = session.id2SVFVarMap.find(condition_svf_var_node_id);
                     stmt = new SelectStmt(dstNode, opVarNodes, condition);
                     stmt->edgeId = edge_id;
                     stmt->value = value;
@@ -1796,9 +3397,9 @@ void GraphDBClient::readPAGEdgesFromDB(lgraph::RpcClient* connection, const std:
                 else if (edgeType == "CmpStmt")
                 {
                     std::vector<SVFVar*> opVarNodes;
-                    std::string op_var_node_ids = cJSON_GetObjectItem(properties, "op_var_node_ids")->valuestring;
+                    std::string op_var_node_ids = properties->getString(DB_FIELD("op_var_node_ids"));
                     parseOpVarString(op_var_node_ids, pag, opVarNodes);
-                    u32_t predicate = cJSON_GetObjectItem(properties, "predicate")->valueint;
+                    u32_t predicate = properties->getInt(DB_FIELD("predicate"));
                     stmt = new CmpStmt(dstNode, opVarNodes, predicate);
                     stmt->edgeId = edge_id;
                     stmt->value = value;
@@ -1814,9 +3415,9 @@ void GraphDBClient::readPAGEdgesFromDB(lgraph::RpcClient* connection, const std:
                 else if (edgeType == "BinaryOPStmt")
                 {
                     std::vector<SVFVar*> opVarNodes;
-                    std::string op_var_node_ids = cJSON_GetObjectItem(properties, "op_var_node_ids")->valuestring;
+                    std::string op_var_node_ids = properties->getString(DB_FIELD("op_var_node_ids"));
                     parseOpVarString(op_var_node_ids, pag, opVarNodes);
-                    u32_t op_code = cJSON_GetObjectItem(properties, "op_code")->valueint;
+                    u32_t op_code = properties->getInt(DB_FIELD("op_code"));
                     stmt = new BinaryOPStmt(dstNode, opVarNodes, op_code);
                     stmt->edgeId = edge_id;
                     stmt->value = value;
@@ -1830,7 +3431,7 @@ void GraphDBClient::readPAGEdgesFromDB(lgraph::RpcClient* connection, const std:
                 }
                 else if (edgeType == "UnaryOPStmt")
                 {
-                    u32_t op_code = cJSON_GetObjectItem(properties, "op_code")->valueint;
+                    u32_t op_code = properties->getInt(DB_FIELD("op_code"));
                     stmt = new UnaryOPStmt(srcNode, dstNode, op_code);
                     stmt->edgeId = edge_id;
                     stmt->value = value;
@@ -1843,10 +3444,10 @@ void GraphDBClient::readPAGEdgesFromDB(lgraph::RpcClient* connection, const std:
                 }
                 else if (edgeType == "BranchStmt")
                 {
-                    int condition_svf_var_node_id = cJSON_GetObjectItem(properties, "condition_svf_var_node_id")->valueint;
-                    int br_inst_svf_var_node_id = cJSON_GetObjectItem(properties, "br_inst_svf_var_node_id")->valueint;
-                    SVFVar* condition = pag->getGNode(condition_svf_var_node_id);
-                    SVFVar* brInst = pag->getGNode(br_inst_svf_var_node_id);
+                    int condition_svf_var_node_id = properties->getInt(DB_FIELD("condition_svf_var_node_id"));
+                    int br_inst_svf_var_node_id = properties->getInt(DB_FIELD("br_inst_svf_var_node_id"));
+                    SVFVar* condition = session.id2SVFVarMap.find(condition_svf_var_node_id);
+                    SVFVar* brInst = session.id2SVFVarMap.find(br_inst_svf_var_node_id);
                     if (condition == nullptr)
                     {
                         SVFUtil::outs() << "Warning: [readPAGEdgesFromDB] No matching condition SVFVar found for id: " << condition_svf_var_node_id << "\n";
@@ -1857,7 +3458,7 @@ void GraphDBClient::readPAGEdgesFromDB(lgraph::RpcClient* connection, const std:
                         SVFUtil::outs() << "Warning: [readPAGEdgesFromDB] No matching brInst SVFVar found for id: " << br_inst_svf_var_node_id << "\n";
                         continue;
                     }
-                    std::string successorsStr = cJSON_GetObjectItem(properties, "successors")->valuestring;
+                    std::string successorsStr = properties->getString(DB_FIELD("successors"));
                     std::vector<std::pair<int, s32_t>> successorsIdVec = parseSuccessorsPairSetFromString(successorsStr);
                     std::vector<std::pair<const ICFGNode*, s32_t>> successors;
                     for (auto& pair : successorsIdVec)
@@ -1887,7 +3488,7 @@ void GraphDBClient::readPAGEdgesFromDB(lgraph::RpcClient* connection, const std:
                 stmt->setStoreEdgeLabelCounter(static_cast<u64_t>(store_edge_label_counter));
                 stmt->setMultiOpndLabelCounter(static_cast<u64_t>(multi_opnd_label_counter));
                 std::string inst2_label_map;
-                cJSON* inst2_label_map_item = cJSON_GetObjectItem(properties,"inst2_label_map");
+                const DBValue* inst2_label_map_item = properties->get(DB_FIELD("inst2_label_map"));
                 if (nullptr != inst2_label_map_item->valuestring)
                 {
                     inst2_label_map = inst2_label_map_item->valuestring;
@@ -1896,7 +3497,7 @@ void GraphDBClient::readPAGEdgesFromDB(lgraph::RpcClient* connection, const std:
                     inst2_label_map = "";
                 }
                 std::string var2_label_map;
-                cJSON* var2_label_map_item = cJSON_GetObjectItem(properties,"var2_label_map");
+                const DBValue* var2_label_map_item = properties->get(DB_FIELD("var2_label_map"));
                 if (nullptr != var2_label_map_item->valuestring)
                 {
                     var2_label_map = var2_label_map_item->valuestring;
@@ -1929,7 +3530,7 @@ void GraphDBClient::readPAGEdgesFromDB(lgraph::RpcClient* connection, const std:
                         const SVFVar* var = nullptr;
                         if (id != -1)
                         {
-                            var = pag->getGNode(id);
+                            var = session.id2SVFVarMap.find(id);
                             if (nullptr == var)
                             {
                                 SVFUtil::outs() << "Warning: [readPAGEdgesFromDB] No matching SVFVar found for id: " << id << " when parsing var2_label_map_ids\n";
@@ -1938,10 +3539,9 @@ void GraphDBClient::readPAGEdgesFromDB(lgraph::RpcClient* connection, const std:
                         stmt->addVar2Labeled(var, label);
                     }
                 }
-                skip += 1;
-                edgeId2SVFStmtMap[stmt->getEdgeID()] = stmt;
+                session.edgeId2SVFStmtMap.set(stmt->getEdgeID(), stmt);
             }
-            cJSON_Delete(root);
+            delete root;
         }
     }
 }
@@ -1953,7 +3553,7 @@ void GraphDBClient::parseOpVarString(std::string& op_var_node_ids, SVFIR* pag, s
         std::vector<int> opVarNodeIds = parseElements2Container<std::vector<int>>(op_var_node_ids);
         for (int varId : opVarNodeIds)
         {
-            SVFVar* var = pag->getGNode(varId);
+            SVFVar* var = getLoadSession().id2SVFVarMap.find(varId);
             if (nullptr != var)
             {
                 opVarNodes.push_back(var);
@@ -1966,73 +3566,65 @@ void GraphDBClient::parseOpVarString(std::string& op_var_node_ids, SVFIR* pag, s
     }
 }
 
-void GraphDBClient::initialSVFPAGNodesFromDB(lgraph::RpcClient* connection, const std::string& dbname, SVFIR* pag)
+void GraphDBClient::initialSVFPAGNodesFromDB(lgraph::RpcClient* connection, const std::string& dbname, SVFIR* pag)
+{
+    // the attributes referring to the other graphs are kept as the nodes are
+    // read and applied by updatePAGNodesFromDB(), no second pass over the labels
+    SVFUtil::outs()<< "Initial SVF PAG nodes from DB....\n";
+    const u32_t numOfNodes = readRowCountFromDB(connection, dbname, pagNodeTypes, false);
+    getLoadSession().id2SVFVarMap.reserve(numOfNodes);
+    getLoadSession().id2funObjVarsMap.reserve(numOfNodes);
+    readLabelsFromDB(connection, dbname, pagNodeTypes, "node", {"node.id"},
+                     [](const std::string& nodeType) { return "MATCH (node:" + nodeType + ")"; },
+                     [this, pag](DBPageReader& reader, const std::string& nodeType)
+                     { readPAGNodesFromDB(reader, nodeType, pag); });
+}
+
+void GraphDBClient::updatePAGNodesFromDB(SVFIR* pag)
+{
+    DBLoadSession& session = getLoadSession();
+    SVFUtil::outs()<< "Updating SVF PAG nodes from DB....\n";
+    // the rows kept by readPAGNodesFromDB(), in the order they were read; under
+    // -db-entry those referring to functions not loaded yet stay for a later load
+    size_t numOfKept = 0;
+    for (const DeferredPAGNodeAttrs& attrs : session.deferredPAGNodeAttrs)
+    {
+        if (DBLazyLoad() && !isPAGNodeAttrsResolvable(attrs, pag))
+        {
+            session.deferredPAGNodeAttrs[numOfKept++] = attrs;
+        }
+        else
+        {
+            updateSVFPAGNodeAttributes(attrs, pag);
+        }
+    }
+    session.deferredPAGNodeAttrs.resize(numOfKept);
+    // the GepValVar/FunObjVar rows are indexed by extIdx, kept until no row is left
+    if (session.deferredPAGNodeAttrs.empty())
+    {
+        std::vector<DeferredPAGNodeAttrs>().swap(session.deferredPAGNodeAttrs);
+        std::vector<DeferredGepValVarAttrs>().swap(session.deferredGepValVarAttrs);
+        std::vector<DeferredFunObjVarAttrs>().swap(session.deferredFunObjVarAttrs);
+    }
+}
+
+bool GraphDBClient::isPAGNodeAttrsResolvable(const DeferredPAGNodeAttrs& attrs, SVFIR* pag) const
 {
-    SVFUtil::outs()<< "Initial SVF PAG nodes from DB....\n";
-    readPAGNodesFromDB(connection, dbname, "ValVar", pag);
-    readPAGNodesFromDB(connection, dbname, "ObjVar", pag);
-    readPAGNodesFromDB(connection, dbname, "ArgValVar", pag);
-    readPAGNodesFromDB(connection, dbname, "GepValVar", pag);
-    readPAGNodesFromDB(connection, dbname, "BaseObjVar", pag);
-    readPAGNodesFromDB(connection, dbname, "GepObjVar", pag);
-    readPAGNodesFromDB(connection, dbname, "HeapObjVar", pag);
-    readPAGNodesFromDB(connection, dbname, "StackObjVar", pag);
-    readPAGNodesFromDB(connection, dbname, "FunObjVar", pag);
-    readPAGNodesFromDB(connection, dbname, "FunValVar", pag);
-    readPAGNodesFromDB(connection, dbname, "GlobalValVar", pag);
-    readPAGNodesFromDB(connection, dbname, "ConstAggValVar", pag);
-    readPAGNodesFromDB(connection, dbname, "ConstDataValVar", pag);
-    readPAGNodesFromDB(connection, dbname, "BlackHoleValVar", pag);
-    readPAGNodesFromDB(connection, dbname, "ConstFPValVar", pag);
-    readPAGNodesFromDB(connection, dbname, "ConstIntValVar", pag);
-    readPAGNodesFromDB(connection, dbname, "ConstNullPtrValVar", pag);
-    readPAGNodesFromDB(connection, dbname, "GlobalObjVar", pag);
-    readPAGNodesFromDB(connection, dbname, "ConstAggObjVar", pag);
-    readPAGNodesFromDB(connection, dbname, "ConstDataObjVar", pag);
-    readPAGNodesFromDB(connection, dbname, "ConstFPObjVar", pag);
-    readPAGNodesFromDB(connection, dbname, "ConstIntObjVar", pag);
-    readPAGNodesFromDB(connection, dbname, "ConstNullPtrObjVar", pag);
-    readPAGNodesFromDB(connection, dbname, "RetValPN", pag);
-    readPAGNodesFromDB(connection, dbname, "VarArgValPN", pag);
-    readPAGNodesFromDB(connection, dbname, "DummyValVar", pag);
-    readPAGNodesFromDB(connection, dbname, "DummyObjVar", pag);
-}
-
-void GraphDBClient::updatePAGNodesFromDB(lgraph::RpcClient* connection, const std::string& dbname, SVFIR* pag)
+    if (attrs.icfgNodeId != -1 && !pag->getICFG()->hasGNode(attrs.icfgNodeId))
+    {
+        return false;
+    }
+    // a function with blocks needs them for its exit block and loop/dom info
+    if (pagNodeTypes[attrs.typeIdx] == "FunObjVar")
+    {
+        return getLoadSession().deferredFunObjVarAttrs[attrs.extIdx].exitBBId == -1 || isFunctionLoaded(attrs.id);
+    }
+    return true;
+}
+
+void GraphDBClient::updateSVFValVarAtrributes(const DeferredPAGNodeAttrs& attrs, ValVar* var, SVFIR* pag)
 {
-    SVFUtil::outs()<< "Updating SVF PAG nodes from DB....\n";
-    updateSVFPAGNodesAttributesFromDB(connection, dbname, "ValVar", pag);
-    updateSVFPAGNodesAttributesFromDB(connection, dbname, "ObjVar", pag);
-    updateSVFPAGNodesAttributesFromDB(connection, dbname, "ArgValVar", pag);
-    updateSVFPAGNodesAttributesFromDB(connection, dbname, "GepValVar", pag);
-    updateSVFPAGNodesAttributesFromDB(connection, dbname, "BaseObjVar", pag);
-    updateSVFPAGNodesAttributesFromDB(connection, dbname, "GepObjVar", pag);
-    updateSVFPAGNodesAttributesFromDB(connection, dbname, "HeapObjVar", pag);
-    updateSVFPAGNodesAttributesFromDB(connection, dbname, "StackObjVar", pag);
-    updateSVFPAGNodesAttributesFromDB(connection, dbname, "FunObjVar", pag);
-    updateSVFPAGNodesAttributesFromDB(connection, dbname, "FunValVar", pag);
-    updateSVFPAGNodesAttributesFromDB(connection, dbname, "GlobalValVar", pag);
-    updateSVFPAGNodesAttributesFromDB(connection, dbname, "ConstAggValVar", pag);
-    updateSVFPAGNodesAttributesFromDB(connection, dbname, "ConstDataValVar", pag);
-    updateSVFPAGNodesAttributesFromDB(connection, dbname, "BlackHoleValVar", pag);
-    updateSVFPAGNodesAttributesFromDB(connection, dbname, "ConstFPValVar", pag);
-    updateSVFPAGNodesAttributesFromDB(connection, dbname, "ConstIntValVar", pag);
-    updateSVFPAGNodesAttributesFromDB(connection, dbname, "ConstNullPtrValVar", pag);
-    updateSVFPAGNodesAttributesFromDB(connection, dbname, "GlobalObjVar", pag);
-    updateSVFPAGNodesAttributesFromDB(connection, dbname, "ConstAggObjVar", pag);
-    updateSVFPAGNodesAttributesFromDB(connection, dbname, "ConstDataObjVar", pag);
-    updateSVFPAGNodesAttributesFromDB(connection, dbname, "ConstFPObjVar", pag);
-    updateSVFPAGNodesAttributesFromDB(connection, dbname, "ConstIntObjVar", pag);
-    updateSVFPAGNodesAttributesFromDB(connection, dbname, "ConstNullPtrObjVar", pag);
-    updateSVFPAGNodesAttributesFromDB(connection, dbname, "RetValPN", pag);
-    updateSVFPAGNodesAttributesFromDB(connection, dbname, "VarArgValPN", pag);
-    updateSVFPAGNodesAttributesFromDB(connection, dbname, "DummyValVar", pag);
-    updateSVFPAGNodesAttributesFromDB(connection, dbname, "DummyObjVar", pag);
-}
-
-void GraphDBClient::updateSVFValVarAtrributes(cJSON* properties, ValVar* var, SVFIR* pag)
-{
-    int icfg_node_id = cJSON_GetObjectItem(properties, "icfg_node_id")->valueint;
+    int icfg_node_id = attrs.icfgNodeId;
     if (icfg_node_id != -1)
     {
         ICFGNode* icfgNode = pag->getICFG()->getGNode(icfg_node_id);
@@ -2047,9 +3639,9 @@ void GraphDBClient::updateSVFValVarAtrributes(cJSON* properties, ValVar* var, SV
     }
 }
 
-void GraphDBClient::updateSVFBaseObjVarAtrributes(cJSON* properties, BaseObjVar* var, SVFIR* pag)
+void GraphDBClient::updateSVFBaseObjVarAtrributes(const DeferredPAGNodeAttrs& attrs, BaseObjVar* var, SVFIR* pag)
 {
-    int icfg_node_id = cJSON_GetObjectItem(properties, "icfg_node_id")->valueint;
+    int icfg_node_id = attrs.icfgNodeId;
     if (icfg_node_id != -1)
     {
         ICFGNode* icfgNode = pag->getICFG()->getGNode(icfg_node_id);
@@ -2064,10 +3656,11 @@ void GraphDBClient::updateSVFBaseObjVarAtrributes(cJSON* properties, BaseObjVar*
     }
 }
 
-void GraphDBClient::updateFunObjVarAttributes(cJSON* properties, FunObjVar* var, SVFIR* pag)
+void GraphDBClient::updateFunObjVarAttributes(const DeferredPAGNodeAttrs& attrs, FunObjVar* var, SVFIR* pag)
 {
-    int real_def_fun_node_id = cJSON_GetObjectItem(properties, "real_def_fun_node_id")->valueint;
-    const FunObjVar* realDefFunNode = id2funObjVarsMap[real_def_fun_node_id];
+    const DeferredFunObjVarAttrs& funAttrs = getLoadSession().deferredFunObjVarAttrs[attrs.extIdx];
+    int real_def_fun_node_id = attrs.refNodeId;
+    const FunObjVar* realDefFunNode = getLoadSession().id2funObjVarsMap.find(real_def_fun_node_id);
     if (nullptr != realDefFunNode)
     {
         var->setRelDefFun(realDefFunNode);
@@ -2077,7 +3670,7 @@ void GraphDBClient::updateFunObjVarAttributes(cJSON* properties, FunObjVar* var,
         SVFUtil::outs() << "Warning: [updateFunObjVarAttributes] No matching FunObjVar found for id: " << real_def_fun_node_id <<" when updating FunObjVar:"<<var->getId()<< "\n";
     }
     
-    int exit_bb_id = cJSON_GetObjectItem(properties, "exit_bb_id")->valueint;
+    int exit_bb_id = funAttrs.exitBBId;
     if (exit_bb_id != -1)
     {
         SVFBasicBlock* exitBB = var->getBasicBlockGraph()->getGNode(exit_bb_id);
@@ -2094,13 +3687,13 @@ void GraphDBClient::updateFunObjVarAttributes(cJSON* properties, FunObjVar* var,
     SVFLoopAndDomInfo* loopAndDom = new SVFLoopAndDomInfo();
     var->setLoopAndDomInfo(loopAndDom);
 
-    std::string reachable_bbs = cJSON_GetObjectItem(properties, "reachable_bbs")->valuestring;
-    std::string dt_bbs_map = cJSON_GetObjectItem(properties, "dt_bbs_map")->valuestring;
-    std::string pdt_bbs_map = cJSON_GetObjectItem(properties, "pdt_bbs_map")->valuestring;
-    std::string df_bbs_map = cJSON_GetObjectItem(properties, "df_bbs_map")->valuestring;
-    std::string bb2_loop_map = cJSON_GetObjectItem(properties, "bb2_loop_map")->valuestring;
-    std::string bb2_p_dom_level = cJSON_GetObjectItem(properties, "bb2_p_dom_level")->valuestring;
-    std::string bb2_pi_dom = cJSON_GetObjectItem(properties, "bb2_pi_dom")->valuestring;
+    std::string reachable_bbs = funAttrs.reachableBBs;
+    const std::string& dt_bbs_map = funAttrs.dtBBsMap;
+    const std::string& pdt_bbs_map = funAttrs.pdtBBsMap;
+    const std::string& df_bbs_map = funAttrs.dfBBsMap;
+    const std::string& bb2_loop_map = funAttrs.bb2LoopMap;
+    const std::string& bb2_p_dom_level = funAttrs.bb2PDomLevel;
+    const std::string& bb2_pi_dom = funAttrs.bb2PIDom;
 
     if (!reachable_bbs.empty())
     {
@@ -2299,9 +3892,10 @@ void GraphDBClient::updateFunObjVarAttributes(cJSON* properties, FunObjVar* var,
         loopAndDom->setBB2PIdom(bb2PiDom);
     }
 }
-void GraphDBClient::updateGepValVarAttributes(cJSON* properties, GepValVar* var, SVFIR* pag)
+void GraphDBClient::updateGepValVarAttributes(const DeferredPAGNodeAttrs& attrs, GepValVar* var, SVFIR* pag)
 {
-    int base_val_id = cJSON_GetObjectItem(properties, "base_val_id")->valueint;
+    const DeferredGepValVarAttrs& gepAttrs = getLoadSession().deferredGepValVarAttrs[attrs.extIdx];
+    int base_val_id = attrs.refNodeId;
     ValVar* baseVal = SVFUtil::dyn_cast<ValVar>(pag->getGNode(base_val_id));
     if (nullptr != baseVal)
     {
@@ -2313,8 +3907,8 @@ void GraphDBClient::updateGepValVarAttributes(cJSON* properties, GepValVar* var,
                         << base_val_id << " when updating GepValVar:" << var->getId()
                         << "\n";
     }
-    s64_t fldIdx = cJSON_GetObjectItem(properties, "ap_fld_idx")->valueint;
-    int ap_gep_pointee_type_id = cJSON_GetObjectItem(properties, "ap_gep_pointee_type_id")->valueint;
+    s64_t fldIdx = gepAttrs.apFldIdx;
+    int ap_gep_pointee_type_id = gepAttrs.apGepPointeeTypeId;
     const SVFType* gepPointeeType = nullptr;
     if (ap_gep_pointee_type_id != -1)
     {
@@ -2332,15 +3926,9 @@ void GraphDBClient::updateGepValVarAttributes(cJSON* properties, GepValVar* var,
             SVFUtil::outs() << "Warning: [updateGepValVarAttributes] No matching SVFType found for ap_gep_pointee_type_id: " << ap_gep_pointee_type_id << " when updating GepValVar:"<<var->getId()<< "\n";
     }
 
-    cJSON* ap_idx_operand_pairs_node = cJSON_GetObjectItem(properties, "ap_idx_operand_pairs");
-    std::string ap_idx_operand_pairs = "";
-    if (nullptr != ap_idx_operand_pairs_node && nullptr != ap_idx_operand_pairs_node->valuestring)
-    {
-        ap_idx_operand_pairs = ap_idx_operand_pairs_node->valuestring;   
-    }
-    parseAPIdxOperandPairsString(ap_idx_operand_pairs, pag, ap);
+    parseAPIdxOperandPairsString(gepAttrs.apIdxOperandPairs, pag, ap);
     var->setAccessPath(ap);
-    int llvm_var_inst_id = cJSON_GetObjectItem(properties, "llvm_var_inst_id")->valueint;
+    int llvm_var_inst_id = gepAttrs.llvmVarInstId;
     pag->addGepValObjFromDB(llvm_var_inst_id, var);
 }
 
@@ -2381,361 +3969,393 @@ void GraphDBClient::parseAPIdxOperandPairsString(const std::string& ap_idx_opera
     }
 }
 
-void GraphDBClient::updateSVFPAGNodesAttributesFromDB(lgraph::RpcClient* connection, const std::string& dbname, std::string nodeType, SVFIR* pag)
+void GraphDBClient::deferPAGNodeAttributes(const DBValue* properties, u32_t typeIdx, NodeID id)
 {
-    int skip = 0;
-    int limit = 1000;
-    while (true)
+    DBLoadSession& session = getLoadSession();
+    if (typeIdx >= pagNodeTypes.size())
+        return;
+    const std::string& nodeType = pagNodeTypes[typeIdx];
+    // GepObjVar and ObjVar have nothing to resolve later
+    if (nodeType == "GepObjVar" || nodeType == "ObjVar")
+        return;
+
+    DeferredPAGNodeAttrs attrs;
+    attrs.id = id;
+    attrs.typeIdx = typeIdx;
+    attrs.icfgNodeId = properties->getInt(DB_FIELD("icfg_node_id"));
+    attrs.refNodeId = -1;
+    attrs.extIdx = 0;
+    if (nodeType == "ArgValVar")
     {
-        std::string result;
-        std::string queryStatement = " MATCH (node:"+nodeType+") RETURN node SKIP "+ std::to_string(skip)+" LIMIT "+std::to_string(limit);
-        cJSON* root = queryFromDB(connection, dbname, queryStatement);
-        if (nullptr == root)
+        attrs.refNodeId = properties->getInt(DB_FIELD("cg_node_id"));
+    }
+    else if (nodeType == "RetValPN" || nodeType == "VarArgValPN")
+    {
+        attrs.refNodeId = properties->getInt(DB_FIELD("call_graph_node_id"));
+    }
+    else if (nodeType == "FunValVar")
+    {
+        attrs.refNodeId = properties->getInt(DB_FIELD("fun_obj_var_node_id"));
+    }
+    else if (nodeType == "GepValVar")
+    {
+        attrs.refNodeId = properties->getInt(DB_FIELD("base_val_id"));
+        attrs.extIdx = session.deferredGepValVarAttrs.size();
+        DeferredGepValVarAttrs gepAttrs;
+        gepAttrs.apFldIdx = properties->getInt(DB_FIELD("ap_fld_idx"));
+        gepAttrs.apGepPointeeTypeId = properties->getInt(DB_FIELD("ap_gep_pointee_type_id"));
+        gepAttrs.llvmVarInstId = properties->getInt(DB_FIELD("llvm_var_inst_id"));
+        gepAttrs.apIdxOperandPairs = properties->getString(DB_FIELD("ap_idx_operand_pairs"));
+        session.deferredGepValVarAttrs.push_back(std::move(gepAttrs));
+    }
+    else if (nodeType == "FunObjVar")
+    {
+        attrs.refNodeId = properties->getInt(DB_FIELD("real_def_fun_node_id"));
+        attrs.extIdx = session.deferredFunObjVarAttrs.size();
+        DeferredFunObjVarAttrs funAttrs;
+        funAttrs.exitBBId = properties->getInt(DB_FIELD("exit_bb_id"));
+        funAttrs.reachableBBs = properties->getString(DB_FIELD("reachable_bbs"));
+        funAttrs.dtBBsMap = properties->getString(DB_FIELD("dt_bbs_map"));
+        funAttrs.pdtBBsMap = properties->getString(DB_FIELD("pdt_bbs_map"));
+        funAttrs.dfBBsMap = properties->getString(DB_FIELD("df_bbs_map"));
+        funAttrs.bb2LoopMap = properties->getString(DB_FIELD("bb2_loop_map"));
+        funAttrs.bb2PDomLevel = properties->getString(DB_FIELD("bb2_p_dom_level"));
+        funAttrs.bb2PIDom = properties->getString(DB_FIELD("bb2_pi_dom"));
+        session.deferredFunObjVarAttrs.push_back(std::move(funAttrs));
+    }
+    session.deferredPAGNodeAttrs.push_back(attrs);
+}
+
+void GraphDBClient::updateSVFPAGNodeAttributes(const DeferredPAGNodeAttrs& attrs, SVFIR* pag)
+{
+    DBLoadSession& session = getLoadSession();
+    const std::string& nodeType = pagNodeTypes[attrs.typeIdx];
+    NodeID id = attrs.id;
+    if (nodeType == "ConstNullPtrValVar")
+    {
+        ConstNullPtrValVar* var = SVFUtil::dyn_cast<ConstNullPtrValVar>(pag->getGNode(id));
+        if (var == nullptr)
         {
-            break;
+            SVFUtil::outs() << "Warning: [updateSVFPAGNodeAttributes] No matching ConstNullPtrValVar found for id: " << id << "\n";
+            return;
+        }
+        updateSVFValVarAtrributes(attrs, var, pag);
+    }
+    else if (nodeType == "ConstIntValVar")
+    {
+        ConstIntValVar* var = SVFUtil::dyn_cast<ConstIntValVar>(pag->getGNode(id));
+        if (var == nullptr)
+        {
+            SVFUtil::outs() << "Warning: [updateSVFPAGNodeAttributes] No matching ConstIntValVar found for id: " << id << "\n";
+            return;
+        }
+        updateSVFValVarAtrributes(attrs, var, pag);
+    }
+    else if (nodeType == "ConstFPValVar")
+    {
+        ConstFPValVar* var = SVFUtil::dyn_cast<ConstFPValVar>(pag->getGNode(id));
+        if (var == nullptr)
+        {
+            SVFUtil::outs() << "Warning: [updateSVFPAGNodeAttributes] No matching ConstFPValVar found for id: " << id << "\n";
+            return;
+        }
+        updateSVFValVarAtrributes(attrs, var, pag);
+    }
+    else if (nodeType == "ArgValVar")
+    {
+        ArgValVar* var = SVFUtil::dyn_cast<ArgValVar>(pag->getGNode(id));
+        if (var == nullptr)
+        {
+            SVFUtil::outs() << "Warning: [updateSVFPAGNodeAttributes] No matching ArgValVar found for id: " << id << "\n";
+            return;
+        }
+        updateSVFValVarAtrributes(attrs, var, pag);
+        int cg_node_id = attrs.refNodeId;
+        FunObjVar* cgNode = session.id2funObjVarsMap.find(cg_node_id);
+        if (nullptr != cgNode)
+        {
+            var->addCGNodeFromDB(cgNode);
         }
         else
         {
-            cJSON* node;
-            cJSON_ArrayForEach(node, root)
-            {
-                cJSON* data = cJSON_GetObjectItem(node, "node");
-                if (!data)
-                    continue;
-                cJSON* properties = cJSON_GetObjectItem(data, "properties");
-                if (!properties)
-                    continue;
-                int id = cJSON_GetObjectItem(properties,"id")->valueint;
-                if (nodeType == "ConstNullPtrValVar")
-                {
-                    ConstNullPtrValVar* var = SVFUtil::dyn_cast<ConstNullPtrValVar>(pag->getGNode(id));
-                    if (var == nullptr)
-                    {
-                        SVFUtil::outs() << "Warning: [updateSVFPAGNodesAttributesFromDB] No matching ConstNullPtrValVar found for id: " << id << "\n";
-                        continue;
-                    }
-                    updateSVFValVarAtrributes(properties, var, pag);
-                }
-                else if (nodeType == "ConstIntValVar")
-                {
-                    ConstIntValVar* var = SVFUtil::dyn_cast<ConstIntValVar>(pag->getGNode(id));
-                    if (var == nullptr)
-                    {
-                        SVFUtil::outs() << "Warning: [updateSVFPAGNodesAttributesFromDB] No matching ConstIntValVar found for id: " << id << "\n";
-                        continue;
-                    }
-                    updateSVFValVarAtrributes(properties, var, pag);
-                }
-                else if (nodeType == "ConstFPValVar")
-                {
-                    ConstFPValVar* var = SVFUtil::dyn_cast<ConstFPValVar>(pag->getGNode(id));
-                    if (var == nullptr)
-                    {
-                        SVFUtil::outs() << "Warning: [updateSVFPAGNodesAttributesFromDB] No matching ConstFPValVar found for id: " << id << "\n";
-                        continue;
-                    }
-                    updateSVFValVarAtrributes(properties, var, pag);
-                }
-                else if (nodeType == "ArgValVar")
-                {
-                    ArgValVar* var = SVFUtil::dyn_cast<ArgValVar>(pag->getGNode(id));
-                    if (var == nullptr)
-                    {
-                        SVFUtil::outs() << "Warning: [updateSVFPAGNodesAttributesFromDB] No matching ArgValVar found for id: " << id << "\n";
-                        continue;
-                    }
-                    updateSVFValVarAtrributes(properties, var, pag);
-                    int cg_node_id = cJSON_GetObjectItem(properties, "cg_node_id")->valueint;
-                    FunObjVar* cgNode = id2funObjVarsMap[cg_node_id];
-                    if (nullptr != cgNode)
-                    {
-                        var->addCGNodeFromDB(cgNode);
-                    }
-                    else
-                    {
-                        SVFUtil::outs() << "Warning: [updateSVFPAGNodesAttributesFromDB] No matching FunObjVar found for id: " << cg_node_id <<" when updating ArgValVar:"<< id << "\n";
-                    }
-                }
-                else if (nodeType == "BlackHoleValVar")
-                {
-                    BlackHoleValVar* var = SVFUtil::dyn_cast<BlackHoleValVar>(pag->getGNode(id));
-                    if (var == nullptr)
-                    {
-                        SVFUtil::outs() << "Warning: [updateSVFPAGNodesAttributesFromDB] No matching BlackHoleValVar found for id: " << id << "\n";
-                        continue;
-                    }
-                    updateSVFValVarAtrributes(properties, var, pag);
-                }
-                else if (nodeType == "ConstDataValVar")
-                {
-                    ConstDataValVar* var = SVFUtil::dyn_cast<ConstDataValVar>(pag->getGNode(id));
-                    if (var == nullptr)
-                    {
-                        SVFUtil::outs() << "Warning: [updateSVFPAGNodesAttributesFromDB] No matching ConstDataValVar found for id: " << id << "\n";
-                        continue;
-                    }
-                    updateSVFValVarAtrributes(properties, var, pag);
-                }
-                else if (nodeType == "RetValPN")
-                {
-                    RetValPN* var = SVFUtil::dyn_cast<RetValPN>(pag->getGNode(id));
-                    if (var == nullptr)
-                    {
-                        SVFUtil::outs() << "Warning: [updateSVFPAGNodesAttributesFromDB] No matching RetValPN found for id: " << id << "\n";
-                        continue;
-                    }
-                    updateSVFValVarAtrributes(properties, var, pag);
-                    int call_graph_node_id = cJSON_GetObjectItem(properties, "call_graph_node_id")->valueint;
-                    FunObjVar* callGraphNode = id2funObjVarsMap[call_graph_node_id];
-                    if (nullptr != callGraphNode)
-                    {
-                        var->setCallGraphNode(callGraphNode);
-                    }
-                    else
-                    {
-                        SVFUtil::outs() << "Warning: [updateSVFPAGNodesAttributesFromDB] No matching FunObjVar found for id: " << call_graph_node_id <<" when updating RetValPN:"<<id<< "\n";
-                    }
-                }
-                else if (nodeType == "VarArgValPN")
-                {
-                    VarArgValPN* var = SVFUtil::dyn_cast<VarArgValPN>(pag->getGNode(id));
-                    if (var == nullptr)
-                    {
-                        SVFUtil::outs() << "Warning: [updateSVFPAGNodesAttributesFromDB] No matching VarArgValPN found for id: " << id << "\n";
-                        continue;
-                    }
-                    updateSVFValVarAtrributes(properties, var, pag);
-                    int call_graph_node_id = cJSON_GetObjectItem(properties, "call_graph_node_id")->valueint;
-                    FunObjVar* callGraphNode = id2funObjVarsMap[call_graph_node_id];
-                    if (nullptr != callGraphNode)
-                    {
-                        var->setCallGraphNode(callGraphNode);
-                        pag->varargFunObjSymMap[callGraphNode] = var->getId();
-                    }
-                    else
-                    {
-                        SVFUtil::outs() << "Warning: [updateSVFPAGNodesAttributesFromDB] No matching FunObjVar found for id: " << call_graph_node_id <<" when updating VarArgValPN:"<<id<< "\n";
-                    }
-                }
-                else if (nodeType == "DummyValVar")
-                {
-                    DummyValVar* var = SVFUtil::dyn_cast<DummyValVar>(pag->getGNode(id));
-                    if (var == nullptr)
-                    {
-                        SVFUtil::outs() << "Warning: [updateSVFPAGNodesAttributesFromDB] No matching DummyValVar found for id: " << id << "\n";
-                        continue;
-                    }
-                    updateSVFValVarAtrributes(properties, var, pag);
-                }
-                else if (nodeType == "ConstAggValVar")
-                {
-                    ConstAggValVar* var = SVFUtil::dyn_cast<ConstAggValVar>(pag->getGNode(id));
-                    if (var == nullptr)
-                    {
-                        SVFUtil::outs() << "Warning: [updateSVFPAGNodesAttributesFromDB] No matching ConstAggValVar found for id: " << id << "\n";
-                        continue;
-                    }
-                    updateSVFValVarAtrributes(properties, var, pag);
-                }
-                else if (nodeType == "GlobalValVar")
-                {
-                    GlobalValVar* var = SVFUtil::dyn_cast<GlobalValVar>(pag->getGNode(id));
-                    if (var == nullptr)
-                    {
-                        SVFUtil::outs() << "Warning: [updateSVFPAGNodesAttributesFromDB] No matching GlobalValVar found for id: " << id << "\n";
-                        continue;
-                    }
-                    updateSVFValVarAtrributes(properties, var, pag);
-                }
-                else if (nodeType == "FunValVar")
-                {
-                    FunValVar* var = SVFUtil::dyn_cast<FunValVar>(pag->getGNode(id));
-                    if (var == nullptr)
-                    {
-                        SVFUtil::outs() << "Warning: [updateSVFPAGNodesAttributesFromDB] No matching FunValVar found for id: " << id << "\n";
-                        continue;
-                    }
-                    updateSVFValVarAtrributes(properties, var, pag);
-                    int fun_obj_var_node_id = cJSON_GetObjectItem(properties, "fun_obj_var_node_id")->valueint;
-                    FunObjVar* funObjVar = id2funObjVarsMap[fun_obj_var_node_id];
-                    if (nullptr != funObjVar)
-                    {
-                        var->setFunction(funObjVar);
-                    }
-                    else
-                    {
-                        SVFUtil::outs() << "Warning: [updateSVFPAGNodesAttributesFromDB] No matching FunObjVar found for id: " << fun_obj_var_node_id <<" when updating FunValVar:"<<id<< "\n";
-                    }
-                }
-                else if (nodeType == "GepValVar")
-                {
-                    GepValVar* var = SVFUtil::dyn_cast<GepValVar>(pag->getGNode(id));
-                    if (var == nullptr)
-                    {
-                        SVFUtil::outs() << "Warning: [updateSVFPAGNodesAttributesFromDB] No matching GepValVar found for id: " << id << "\n";
-                        continue;
-                    }
-                    updateSVFValVarAtrributes(properties, var, pag);
-                    updateGepValVarAttributes(properties, var, pag);
-    
-                }
-                else if (nodeType == "ValVar")
-                {
-                    ValVar* var = SVFUtil::dyn_cast<ValVar>(pag->getGNode(id));
-                    if (var == nullptr)
-                    {
-                        SVFUtil::outs() << "Warning: [updateSVFPAGNodesAttributesFromDB] No matching ValVar found for id: " << id << "\n";
-                        continue;
-                    }
-                    updateSVFValVarAtrributes(properties, var, pag);
-                }
-                else if (nodeType == "ConstNullPtrObjVar")
-                {
-                    ConstNullPtrObjVar* var = SVFUtil::dyn_cast<ConstNullPtrObjVar>(pag->getGNode(id));
-                    if (var == nullptr)
-                    {
-                        SVFUtil::outs() << "Warning: [updateSVFPAGNodesAttributesFromDB] No matching ConstNullPtrObjVar found for id: " << id << "\n";
-                        continue;
-                    }
-                    updateSVFBaseObjVarAtrributes(properties, var, pag);
-                }
-                else if (nodeType == "ConstIntObjVar")
-                {
-                    ConstIntObjVar* var = SVFUtil::dyn_cast<ConstIntObjVar>(pag->getGNode(id));
-                    if (var == nullptr)
-                    {
-                        SVFUtil::outs() << "Warning: [updateSVFPAGNodesAttributesFromDB] No matching ConstIntObjVar found for id: " << id << "\n";
-                        continue;
-                    }
-                    updateSVFBaseObjVarAtrributes(properties, var, pag);
-                }
-                else if (nodeType == "ConstFPObjVar")
-                {
-                    ConstFPObjVar* var = SVFUtil::dyn_cast<ConstFPObjVar>(pag->getGNode(id));
-                    if (var == nullptr)
-                    {
-                        SVFUtil::outs() << "Warning: [updateSVFPAGNodesAttributesFromDB] No matching ConstFPObjVar found for id: " << id << "\n";
-                        continue;
-                    }
-                    updateSVFBaseObjVarAtrributes(properties, var, pag);
-                }
-                else if (nodeType == "ConstDataObjVar")
-                {
-                    ConstDataObjVar* var = SVFUtil::dyn_cast<ConstDataObjVar>(pag->getGNode(id));
-                    if (var == nullptr)
-                    {
-                        SVFUtil::outs() << "Warning: [updateSVFPAGNodesAttributesFromDB] No matching ConstDataObjVar found for id: " << id << "\n";
-                        continue;
-                    }
-                    updateSVFBaseObjVarAtrributes(properties, var, pag);
-                }
-                else if (nodeType == "DummyObjVar")
-                {
-                    DummyObjVar* var = SVFUtil::dyn_cast<DummyObjVar>(pag->getGNode(id));
-                    if (var == nullptr)
-                    {
-                        SVFUtil::outs() << "Warning: [updateSVFPAGNodesAttributesFromDB] No matching DummyObjVar found for id: " << id << "\n";
-                        continue;
-                    }
-                    updateSVFBaseObjVarAtrributes(properties, var, pag);
-                }
-                else if (nodeType == "ConstAggObjVar")
-                {
-                    ConstAggObjVar* var = SVFUtil::dyn_cast<ConstAggObjVar>(pag->getGNode(id));
-                    if (var == nullptr)
-                    {
-                        SVFUtil::outs() << "Warning: [updateSVFPAGNodesAttributesFromDB] No matching ConstAggObjVar found for id: " << id << "\n";
-                        continue;
-                    }
-                    updateSVFBaseObjVarAtrributes(properties, var, pag);
-                }
-                else if (nodeType == "GlobalObjVar")
-                {
-                    GlobalObjVar* var = SVFUtil::dyn_cast<GlobalObjVar>(pag->getGNode(id));
-                    if (var == nullptr)
-                    {
-                        SVFUtil::outs() << "Warning: [updateSVFPAGNodesAttributesFromDB] No matching GlobalObjVar found for id: " << id << "\n";
-                        continue;
-                    }
-                    updateSVFBaseObjVarAtrributes(properties, var, pag);
-                }
-                else if (nodeType == "FunObjVar")
-                {
-                    FunObjVar* var = SVFUtil::dyn_cast<FunObjVar>(pag->getGNode(id));
-                    if (var == nullptr)
-                    {
-                        SVFUtil::outs() << "Warning: [updateSVFPAGNodesAttributesFromDB] No matching FunObjVar found for id: " << id << "\n";
-                        continue;
-                    }
-                    updateSVFBaseObjVarAtrributes(properties, var, pag);
-                    updateFunObjVarAttributes(properties, var, pag);
-                }
-                else if (nodeType == "StackObjVar")
-                {
-                    StackObjVar* var = SVFUtil::dyn_cast<StackObjVar>(pag->getGNode(id));
-                    if (var == nullptr)
-                    {
-                        SVFUtil::outs() << "Warning: [updateSVFPAGNodesAttributesFromDB] No matching StackObjVar found for id: " << id << "\n";
-                        continue;
-                    }
-                    updateSVFBaseObjVarAtrributes(properties, var, pag);
-                }
-                else if (nodeType == "HeapObjVar")
-                {
-                    HeapObjVar* var = SVFUtil::dyn_cast<HeapObjVar>(pag->getGNode(id));
-                    if (var == nullptr)
-                    {
-                        SVFUtil::outs() << "Warning: [updateSVFPAGNodesAttributesFromDB] No matching HeapObjVar found for id: " << id << "\n";
-                        continue;
-                    }
-                    updateSVFBaseObjVarAtrributes(properties, var, pag);
-                }
-                else if (nodeType == "BaseObjVar")
-                {
-                    BaseObjVar* var = SVFUtil::dyn_cast<BaseObjVar>(pag->getGNode(id));
-                    if (var == nullptr)
-                    {
-                        SVFUtil::outs() << "Warning: [updateSVFPAGNodesAttributesFromDB] No matching BaseObjVar found for id: " << id << "\n";
-                        continue;
-                    }
-                    updateSVFBaseObjVarAtrributes(properties, var, pag);
-                }
-                skip += 1;
-            }
-            cJSON_Delete(root);
+            SVFUtil::outs() << "Warning: [updateSVFPAGNodeAttributes] No matching FunObjVar found for id: " << cg_node_id <<" when updating ArgValVar:"<< id << "\n";
+        }
+    }
+    else if (nodeType == "BlackHoleValVar")
+    {
+        BlackHoleValVar* var = SVFUtil::dyn_cast<BlackHoleValVar>(pag->getGNode(id));
+        if (var == nullptr)
+        {
+            SVFUtil::outs() << "Warning: [updateSVFPAGNodeAttributes] No matching BlackHoleValVar found for id: " << id << "\n";
+            return;
+        }
+        updateSVFValVarAtrributes(attrs, var, pag);
+    }
+    else if (nodeType == "ConstDataValVar")
+    {
+        ConstDataValVar* var = SVFUtil::dyn_cast<ConstDataValVar>(pag->getGNode(id));
+        if (var == nullptr)
+        {
+            SVFUtil::outs() << "Warning: [updateSVFPAGNodeAttributes] No matching ConstDataValVar found for id: " << id << "\n";
+            return;
+        }
+        updateSVFValVarAtrributes(attrs, var, pag);
+    }
+    else if (nodeType == "RetValPN")
+    {
+        RetValPN* var = SVFUtil::dyn_cast<RetValPN>(pag->getGNode(id));
+        if (var == nullptr)
+        {
+            SVFUtil::outs() << "Warning: [updateSVFPAGNodeAttributes] No matching RetValPN found for id: " << id << "\n";
+            return;
+        }
+        updateSVFValVarAtrributes(attrs, var, pag);
+        int call_graph_node_id = attrs.refNodeId;
+        FunObjVar* callGraphNode = session.id2funObjVarsMap.find(call_graph_node_id);
+        if (nullptr != callGraphNode)
+        {
+            var->setCallGraphNode(callGraphNode);
+        }
+        else
+        {
+            SVFUtil::outs() << "Warning: [updateSVFPAGNodeAttributes] No matching FunObjVar found for id: " << call_graph_node_id <<" when updating RetValPN:"<<id<< "\n";
+        }
+    }
+    else if (nodeType == "VarArgValPN")
+    {
+        VarArgValPN* var = SVFUtil::dyn_cast<VarArgValPN>(pag->getGNode(id));
+        if (var == nullptr)
+        {
+            SVFUtil::outs() << "Warning: [updateSVFPAGNodeAttributes] No matching VarArgValPN found for id: " << id << "\n";
+            return;
+        }
+        updateSVFValVarAtrributes(attrs, var, pag);
+        int call_graph_node_id = attrs.refNodeId;
+        FunObjVar* callGraphNode = session.id2funObjVarsMap.find(call_graph_node_id);
+        if (nullptr != callGraphNode)
+        {
+            var->setCallGraphNode(callGraphNode);
+            pag->varargFunObjSymMap[callGraphNode] = var->getId();
+        }
+        else
+        {
+            SVFUtil::outs() << "Warning: [updateSVFPAGNodeAttributes] No matching FunObjVar found for id: " << call_graph_node_id <<" when updating VarArgValPN:"<<id<< "\n";
+        }
+    }
+    else if (nodeType == "DummyValVar")
+    {
+        DummyValVar* var = SVFUtil::dyn_cast<DummyValVar>(pag->getGNode(id));
+        if (var == nullptr)
+        {
+            SVFUtil::outs() << "Warning: [updateSVFPAGNodeAttributes] No matching DummyValVar found for id: " << id << "\n";
+            return;
         }
-
+        updateSVFValVarAtrributes(attrs, var, pag);
+    }
+    else if (nodeType == "ConstAggValVar")
+    {
+        ConstAggValVar* var = SVFUtil::dyn_cast<ConstAggValVar>(pag->getGNode(id));
+        if (var == nullptr)
+        {
+            SVFUtil::outs() << "Warning: [updateSVFPAGNodeAttributes] No matching ConstAggValVar found for id: " << id << "\n";
+            return;
+        }
+        updateSVFValVarAtrributes(attrs, var, pag);
+    }
+    else if (nodeType == "GlobalValVar")
+    {
+        GlobalValVar* var = SVFUtil::dyn_cast<GlobalValVar>(pag->getGNode(id));
+        if (var == nullptr)
+        {
+            SVFUtil::outs() << "Warning: [updateSVFPAGNodeAttributes] No matching GlobalValVar found for id: " << id << "\n";
+            return;
+        }
+        updateSVFValVarAtrributes(attrs, var, pag);
+    }
+    else if (nodeType == "FunValVar")
+    {
+        FunValVar* var = SVFUtil::dyn_cast<FunValVar>(pag->getGNode(id));
+        if (var == nullptr)
+        {
+            SVFUtil::outs() << "Warning: [updateSVFPAGNodeAttributes] No matching FunValVar found for id: " << id << "\n";
+            return;
+        }
+        updateSVFValVarAtrributes(attrs, var, pag);
+        int fun_obj_var_node_id = attrs.refNodeId;
+        FunObjVar* funObjVar = session.id2funObjVarsMap.find(fun_obj_var_node_id);
+        if (nullptr != funObjVar)
+        {
+            var->setFunction(funObjVar);
+        }
+        else
+        {
+            SVFUtil::outs() << "Warning: [updateSVFPAGNodeAttributes] No matching FunObjVar found for id: " << fun_obj_var_node_id <<" when updating FunValVar:"<<id<< "\n";
+        }
+    }
+    else if (nodeType == "GepValVar")
+    {
+        GepValVar* var = SVFUtil::dyn_cast<GepValVar>(pag->getGNode(id));
+        if (var == nullptr)
+        {
+            SVFUtil::outs() << "Warning: [updateSVFPAGNodeAttributes] No matching GepValVar found for id: " << id << "\n";
+            return;
+        }
+        updateSVFValVarAtrributes(attrs, var, pag);
+        updateGepValVarAttributes(attrs, var, pag);
+    
+    }
+    else if (nodeType == "ValVar")
+    {
+        ValVar* var = SVFUtil::dyn_cast<ValVar>(pag->getGNode(id));
+        if (var == nullptr)
+        {
+            SVFUtil::outs() << "Warning: [updateSVFPAGNodeAttributes] No matching ValVar found for id: " << id << "\n";
+            return;
+        }
+        updateSVFValVarAtrributes(attrs, var, pag);
+    }
+    else if (nodeType == "ConstNullPtrObjVar")
+    {
+        ConstNullPtrObjVar* var = SVFUtil::dyn_cast<ConstNullPtrObjVar>(pag->getGNode(id));
+        if (var == nullptr)
+        {
+            SVFUtil::outs() << "Warning: [updateSVFPAGNodeAttributes] No matching ConstNullPtrObjVar found for id: " << id << "\n";
+            return;
+        }
+        updateSVFBaseObjVarAtrributes(attrs, var, pag);
+    }
+    else if (nodeType == "ConstIntObjVar")
+    {
+        ConstIntObjVar* var = SVFUtil::dyn_cast<ConstIntObjVar>(pag->getGNode(id));
+        if (var == nullptr)
+        {
+            SVFUtil::outs() << "Warning: [updateSVFPAGNodeAttributes] No matching ConstIntObjVar found for id: " << id << "\n";
+            return;
+        }
+        updateSVFBaseObjVarAtrributes(attrs, var, pag);
+    }
+    else if (nodeType == "ConstFPObjVar")
+    {
+        ConstFPObjVar* var = SVFUtil::dyn_cast<ConstFPObjVar>(pag->getGNode(id));
+        if (var == nullptr)
+        {
+            SVFUtil::outs() << "Warning: [updateSVFPAGNodeAttributes] No matching ConstFPObjVar found for id: " << id << "\n";
+            return;
+        }
+        updateSVFBaseObjVarAtrributes(attrs, var, pag);
+    }
+    else if (nodeType == "ConstDataObjVar")
+    {
+        ConstDataObjVar* var = SVFUtil::dyn_cast<ConstDataObjVar>(pag->getGNode(id));
+        if (var == nullptr)
+        {
+            SVFUtil::outs() << "Warning: [updateSVFPAGNodeAttributes] No matching ConstDataObjVar found for id: " << id << "\n";
+            return;
+        }
+        updateSVFBaseObjVarAtrributes(attrs, var, pag);
+    }
+    else if (nodeType == "DummyObjVar")
+    {
+        DummyObjVar* var = SVFUtil::dyn_cast<DummyObjVar>(pag->getGNode(id));
+        if (var == nullptr)
+        {
+            SVFUtil::outs() << "Warning: [updateSVFPAGNodeAttributes] No matching DummyObjVar found for id: " << id << "\n";
+            return;
+        }
+        updateSVFBaseObjVarAtrributes(attrs, var, pag);
+    }
+    else if (nodeType == "ConstAggObjVar")
+    {
+        ConstAggObjVar* var = SVFUtil::dyn_cast<ConstAggObjVar>(pag->getGNode(id));
+        if (var == nullptr)
+        {
+            SVFUtil::outs() << "Warning: [updateSVFPAGNodeAttributes] No matching ConstAggObjVar found for id: " << id << "\n";
+            return;
+        }
+        updateSVFBaseObjVarAtrributes(attrs, var, pag);
+    }
+    else if (nodeType == "GlobalObjVar")
+    {
+        GlobalObjVar* var = SVFUtil::dyn_cast<GlobalObjVar>(pag->getGNode(id));
+        if (var == nullptr)
+        {
+            SVFUtil::outs() << "Warning: [updateSVFPAGNodeAttributes] No matching GlobalObjVar found for id: " << id << "\n";
+            return;
+        }
+        updateSVFBaseObjVarAtrributes(attrs, var, pag);
+    }
+    else if (nodeType == "FunObjVar")
+    {
+        FunObjVar* var = SVFUtil::dyn_cast<FunObjVar>(pag->getGNode(id));
+        if (var == nullptr)
+        {
+            SVFUtil::outs() << "Warning: [updateSVFPAGNodeAttributes] No matching FunObjVar found for id: " << id << "\n";
+            return;
+        }
+        updateSVFBaseObjVarAtrributes(attrs, var, pag);
+        updateFunObjVarAttributes(attrs, var, pag);
+    }
+    else if (nodeType == "StackObjVar")
+    {
+        StackObjVar* var = SVFUtil::dyn_cast<StackObjVar>(pag->getGNode(id));
+        if (var == nullptr)
+        {
+            SVFUtil::outs() << "Warning: [updateSVFPAGNodeAttributes] No matching StackObjVar found for id: " << id << "\n";
+            return;
+        }
+        updateSVFBaseObjVarAtrributes(attrs, var, pag);
+    }
+    else if (nodeType == "HeapObjVar")
+    {
+        HeapObjVar* var = SVFUtil::dyn_cast<HeapObjVar>(pag->getGNode(id));
+        if (var == nullptr)
+        {
+            SVFUtil::outs() << "Warning: [updateSVFPAGNodeAttributes] No matching HeapObjVar found for id: " << id << "\n";
+            return;
+        }
+        updateSVFBaseObjVarAtrributes(attrs, var, pag);
+    }
+    else if (nodeType == "BaseObjVar")
+    {
+        BaseObjVar* var = SVFUtil::dyn_cast<BaseObjVar>(pag->getGNode(id));
+        if (var == nullptr)
+        {
+            SVFUtil::outs() << "Warning: [updateSVFPAGNodeAttributes] No matching BaseObjVar found for id: " << id << "\n";
+            return;
+        }
+        updateSVFBaseObjVarAtrributes(attrs, var, pag);
     }
 }
 
-
 void GraphDBClient::readPAGNodesFromDB(lgraph::RpcClient* connection, const std::string& dbname, std::string nodeType, SVFIR* pag)
 {
-    int skip = 0;
-    int limit = 1000;
+    DBPageReader reader(connection, dbname, "MATCH (node:"+nodeType+")", "node", {"node.id"});
+    readPAGNodesFromDB(reader, nodeType, pag);
+}
+
+void GraphDBClient::readPAGNodesFromDB(DBPageReader& reader, std::string nodeType, SVFIR* pag)
+{
+    const u32_t typeIdx = std::find(pagNodeTypes.begin(), pagNodeTypes.end(), nodeType) - pagNodeTypes.begin();
     while (true)
     {
-        std::string result;
-        std::string queryStatement = " MATCH (node:"+nodeType+") RETURN node SKIP "+std::to_string(skip)+" LIMIT "+std::to_string(limit);
-        cJSON* root = queryFromDB(connection, dbname, queryStatement);
+        DBResult* root = reader.next();
         if (nullptr == root)
         {
             break;
         }
         else
         {
-            cJSON* node;
-            cJSON_ArrayForEach(node, root)
+            for (const DBValue* node : *root)
             {
-                cJSON* data = cJSON_GetObjectItem(node, "node");
+                const DBValue* data = node->get(DB_FIELD("node"));
                 if (!data)
                     continue;
-                cJSON* properties = cJSON_GetObjectItem(data, "properties");
+                const DBValue* properties = data->get(DB_FIELD("properties"));
                 if (!properties)
                     continue;
                 SVFVar* var = nullptr;
-                int id = cJSON_GetObjectItem(properties,"id")->valueint;
-                int svfTypeId = cJSON_GetObjectItem(properties, "svf_type_id")->valueint;
+                int id = properties->getInt(DB_FIELD("id"));
+                int svfTypeId = properties->getInt(DB_FIELD("svf_type_id"));
                 const SVFType* type = pag->getSVFType(svfTypeId);
                 if (type == nullptr)
                 {
@@ -2750,22 +4370,22 @@ void GraphDBClient::readPAGNodesFromDB(lgraph::RpcClient* connection, const std:
                 }
                 else if (nodeType == "ConstIntValVar")
                 {
-                    u64_t zval = std::stoull(cJSON_GetObjectItem(properties, "zval")->valuestring);
-                    s64_t sval = cJSON_GetObjectItem(properties, "sval")->valueint;
+                    u64_t zval = std::stoull(properties->getString(DB_FIELD("zval")));
+                    s64_t sval = properties->getInt(DB_FIELD("sval"));
                     var = new ConstIntValVar(id, sval, zval, nullptr, type);
                     pag->addValNode(SVFUtil::cast<ConstIntValVar>(var));
                     NodeIDAllocator::get()->increaseNumOfValues();
                 }
                 else if (nodeType == "ConstFPValVar")
                 {
-                    double dval = cJSON_GetObjectItem(properties, "dval")->valuedouble;
+                    double dval = properties->getDouble(DB_FIELD("dval"));
                     var = new ConstFPValVar(id, dval, nullptr, type);
                     pag->addValNode(SVFUtil::cast<ConstFPValVar>(var));
                     NodeIDAllocator::get()->increaseNumOfValues();
                 }
                 else if (nodeType == "ArgValVar")
                 {
-                    u32_t arg_no = static_cast<u32_t>(cJSON_GetObjectItem(properties, "arg_no")->valueint);
+                    u32_t arg_no = static_cast<u32_t>(properties->getInt(DB_FIELD("arg_no")));
                     var = new ArgValVar(id,arg_no, nullptr, nullptr, type);
                     pag->addValNode(SVFUtil::cast<ArgValVar>(var));
                     NodeIDAllocator::get()->increaseNumOfValues();
@@ -2820,7 +4440,7 @@ void GraphDBClient::readPAGNodesFromDB(lgraph::RpcClient* connection, const std:
                 }
                 else if (nodeType == "GepValVar")
                 {
-                    int gep_val_svf_type_id = cJSON_GetObjectItem(properties, "gep_val_svf_type_id")->valueint;
+                    int gep_val_svf_type_id = properties->getInt(DB_FIELD("gep_val_svf_type_id"));
                     const SVFType* gepValType = pag->getSVFType(gep_val_svf_type_id);
                     SVF::AccessPath ap;  
                     var = new GepValVar(nullptr, id, ap, gepValType, nullptr);
@@ -2843,8 +4463,8 @@ void GraphDBClient::readPAGNodesFromDB(lgraph::RpcClient* connection, const std:
                 else if (nodeType == "ConstIntObjVar")
                 {
                     ObjTypeInfo* objTypeInfo = parseObjTypeInfoFromDB(properties, pag);
-                    u64_t zval = std::stoull(cJSON_GetObjectItem(properties, "zval")->valuestring);
-                    s64_t sval = cJSON_GetObjectItem(properties, "sval")->valueint;
+                    u64_t zval = std::stoull(properties->getString(DB_FIELD("zval")));
+                    s64_t sval = properties->getInt(DB_FIELD("sval"));
                     var = new ConstIntObjVar(id, sval, zval, objTypeInfo, nullptr);
                     pag->addBaseObjNode(SVFUtil::cast<ConstIntObjVar>(var));
                     NodeIDAllocator::get()->increaseNumOfObjAndNodes();
@@ -2852,7 +4472,7 @@ void GraphDBClient::readPAGNodesFromDB(lgraph::RpcClient* connection, const std:
                 else if (nodeType == "ConstFPObjVar")
                 {
                     ObjTypeInfo* objTypeInfo = parseObjTypeInfoFromDB(properties, pag);
-                    float dval = (float)(cJSON_GetObjectItem(properties, "dval")->valuedouble);
+                    float dval = (float)(properties->getDouble(DB_FIELD("dval")));
                     var = new ConstFPObjVar(id, dval, objTypeInfo, nullptr);
                     pag->addBaseObjNode(SVFUtil::cast<ConstFPObjVar>(var));
                     NodeIDAllocator::get()->increaseNumOfObjAndNodes();
@@ -2888,7 +4508,7 @@ void GraphDBClient::readPAGNodesFromDB(lgraph::RpcClient* connection, const std:
                 {
                     ObjTypeInfo* objTypeInfo = parseObjTypeInfoFromDB(properties, pag);
                     var = new GlobalObjVar(id, objTypeInfo, nullptr);
-                    std::string val_name = cJSON_GetObjectItem(properties, "val_name")->valuestring;
+                    std::string val_name = properties->getString(DB_FIELD("val_name"));
                     if (!val_name.empty())
                     {
                         var->setName(val_name);
@@ -2899,31 +4519,31 @@ void GraphDBClient::readPAGNodesFromDB(lgraph::RpcClient* connection, const std:
                 else if (nodeType == "FunObjVar")
                 {
                     ObjTypeInfo* objTypeInfo = parseObjTypeInfoFromDB(properties, pag);
-                    bool is_decl = cJSON_IsTrue(cJSON_GetObjectItem(properties, "is_decl"));
-                    bool intrinsic = cJSON_IsTrue(cJSON_GetObjectItem(properties, "intrinsic"));
-                    bool is_addr_taken = cJSON_IsTrue(cJSON_GetObjectItem(properties, "is_addr_taken"));
-                    bool is_uncalled = cJSON_IsTrue(cJSON_GetObjectItem(properties, "is_uncalled"));
-                    bool is_not_return = cJSON_IsTrue(cJSON_GetObjectItem(properties, "is_not_ret"));
-                    bool sup_var_arg = cJSON_IsTrue(cJSON_GetObjectItem(properties, "sup_var_arg"));
-                    int fun_type_id = cJSON_GetObjectItem(properties, "fun_type_id")->valueint;
+                    bool is_decl = properties->getBool(DB_FIELD("is_decl"));
+                    bool intrinsic = properties->getBool(DB_FIELD("intrinsic"));
+                    bool is_addr_taken = properties->getBool(DB_FIELD("is_addr_taken"));
+                    bool is_uncalled = properties->getBool(DB_FIELD("is_uncalled"));
+                    bool is_not_return = properties->getBool(DB_FIELD("is_not_ret"));
+                    bool sup_var_arg = properties->getBool(DB_FIELD("sup_var_arg"));
+                    int fun_type_id = properties->getInt(DB_FIELD("fun_type_id"));
                     const SVFFunctionType* funcType = SVFUtil::dyn_cast<SVFFunctionType>(pag->getSVFType(fun_type_id));
                     var = new FunObjVar(id, objTypeInfo, nullptr);
                     FunObjVar* funObjVar = SVFUtil::cast<FunObjVar>(var);
                     std::vector<const SVF::ArgValVar*> emptyArgs;
                     funObjVar->initFunObjVar(is_decl, intrinsic, is_addr_taken, is_uncalled, is_not_return, sup_var_arg, funcType, nullptr, nullptr, nullptr, emptyArgs, nullptr);  
-                    std::string func_annotation = cJSON_GetObjectItem(properties, "func_annotation")->valuestring;
+                    std::string func_annotation = properties->getString(DB_FIELD("func_annotation"));
                     if (!func_annotation.empty())
                     {
                         std::vector<std::string> func_annotation_vector;
                         func_annotation_vector = deserializeAnnotations(func_annotation);
                         ExtAPI::getExtAPI()->setExtFuncAnnotations(funObjVar, func_annotation_vector);
                     }
-                    std::string val_name = cJSON_GetObjectItem(properties, "val_name")->valuestring;
+                    std::string val_name = properties->getString(DB_FIELD("val_name"));
                     if (!val_name.empty())
                     {
                         funObjVar->setName(val_name);
                     }
-                    std::string all_args_node_ids = cJSON_GetObjectItem(properties, "all_args_node_ids")->valuestring;
+                    std::string all_args_node_ids = properties->getString(DB_FIELD("all_args_node_ids"));
                     if (!all_args_node_ids.empty())
                     {
                         std::vector<int> all_args_node_ids_vec = parseElements2Container<std::vector<int>>(all_args_node_ids);
@@ -2941,7 +4561,7 @@ void GraphDBClient::readPAGNodesFromDB(lgraph::RpcClient* connection, const std:
                         }
                     }
                     pag->addBaseObjNode(funObjVar);
-                    id2funObjVarsMap[id] = funObjVar;  
+                    getLoadSession().id2funObjVarsMap.set(id, funObjVar);
                     NodeIDAllocator::get()->increaseNumOfObjAndNodes();              
                 }
                 else if (nodeType == "StackObjVar")
@@ -2967,8 +4587,8 @@ void GraphDBClient::readPAGNodesFromDB(lgraph::RpcClient* connection, const std:
                 }
                 else if (nodeType == "GepObjVar")
                 {
-                    s64_t app_offset = cJSON_GetObjectItem(properties, "app_offset")->valueint;
-                    int base_obj_var_node_id = cJSON_GetObjectItem(properties, "base_obj_var_node_id")->valueint;
+                    s64_t app_offset = properties->getInt(DB_FIELD("app_offset"));
+                    int base_obj_var_node_id = properties->getInt(DB_FIELD("base_obj_var_node_id"));
                     const BaseObjVar* baseObj = pag->getBaseObject(base_obj_var_node_id);
                     var = new GepObjVar(baseObj, id, app_offset);
                     pag->addGepObjNode(SVFUtil::cast<GepObjVar>(var), base_obj_var_node_id, app_offset);
@@ -2986,21 +4606,25 @@ void GraphDBClient::readPAGNodesFromDB(lgraph::RpcClient* connection, const std:
                 {
                     var->setSourceLoc(sourceLocation);
                 }
-                skip += 1;
+                if (var != nullptr)
+                {
+                    getLoadSession().id2SVFVarMap.set(id, var);
+                    deferPAGNodeAttributes(properties, typeIdx, id);
+                }
             }
-            cJSON_Delete(root);
+            delete root;
         }
     }
 }
 
-ObjTypeInfo* GraphDBClient::parseObjTypeInfoFromDB(cJSON* properties, SVFIR* pag)
+ObjTypeInfo* GraphDBClient::parseObjTypeInfoFromDB(const DBValue* properties, SVFIR* pag)
 {
-    int obj_type_info_type_id = cJSON_GetObjectItem(properties, "obj_type_info_type_id")->valueint;
+    int obj_type_info_type_id = properties->getInt(DB_FIELD("obj_type_info_type_id"));
     const SVFType* objTypeInfoType = pag->getSVFType(obj_type_info_type_id);
-    int obj_type_info_flags = cJSON_GetObjectItem(properties, "obj_type_info_flags")->valueint;
-    int obj_type_info_max_offset_limit = cJSON_GetObjectItem(properties, "obj_type_info_max_offset_limit")->valueint;
-    int obj_type_info_elem_num = cJSON_GetObjectItem(properties, "obj_type_info_elem_num")->valueint;
-    int obj_type_info_byte_size = cJSON_GetObjectItem(properties, "obj_type_info_byte_size")->valueint;
+    int obj_type_info_flags = properties->getInt(DB_FIELD("obj_type_info_flags"));
+    int obj_type_info_max_offset_limit = properties->getInt(DB_FIELD("obj_type_info_max_offset_limit"));
+    int obj_type_info_elem_num = properties->getInt(DB_FIELD("obj_type_info_elem_num"));
+    int obj_type_info_byte_size = properties->getInt(DB_FIELD("obj_type_info_byte_size"));
     ObjTypeInfo* objTypeInfo = new ObjTypeInfo(objTypeInfoType, obj_type_info_max_offset_limit);
     objTypeInfo->setFlag(static_cast<SVF::ObjTypeInfo::MEMTYPE>(obj_type_info_flags));
     objTypeInfo->setNumOfElements(obj_type_info_elem_num);
@@ -3010,28 +4634,28 @@ ObjTypeInfo* GraphDBClient::parseObjTypeInfoFromDB(cJSON* properties, SVFIR* pag
     return nullptr;
 }
 
-cJSON* GraphDBClient::queryFromDB(lgraph::RpcClient* connection, const std::string& dbname, std::string queryStatement)
+DBResult* GraphDBClient::queryFromDB(lgraph::RpcClient* connection, const std::string& dbname, std::string queryStatement)
 {
     // parse all SVFType
     std::string result;
-    if (!connection->CallCypher(result, queryStatement, dbname))
+    if (!DBSnapshot::query(connection, result, queryStatement, dbname))
     {
         SVFUtil::outs() << queryStatement<< "\n";
         SVFUtil::outs() << "Failed to query from DB:" << result << "\n";
         return nullptr;
     } 
-    cJSON* root = cJSON_Parse(result.c_str());
-    if (!root || !cJSON_IsArray(root))
+    DBResult* root = new DBResult(std::move(result));
+    if (!root->isValid())
     {
         SVFUtil::outs() << "Invalid JSON format: "<<queryStatement<<"\n";
-        cJSON_Delete(root);
+        delete root;
         return nullptr;
     }
     // TODO: need to fix: all graph should support pagination query not only the PAG
-    if (dbname != "BasicBlockGraph" && result=="[]")
+    if (dbname != "BasicBlockGraph" && root->size() == 0)
     {
         SVFUtil::outs() << "No data found for query: " << queryStatement << "\n";
-        cJSON_Delete(root);
+        delete root;
         return nullptr;
     }
 
@@ -3041,58 +4665,79 @@ cJSON* GraphDBClient::queryFromDB(lgraph::RpcClient* connection, const std::stri
 void GraphDBClient::readBasicBlockGraphFromDB(lgraph::RpcClient* connection, const std::string& dbname)
 {
     SVFUtil::outs()<< "Build BasicBlockGraph from DB....\n";
-    for (auto& item : id2funObjVarsMap)
+    // every function gets a graph, also those without any block
+    for (FunObjVar* funObjVar : getLoadSession().id2funObjVarsMap)
+    {
+        if (nullptr != funObjVar)
+            funObjVar->setBasicBlockGraph(new BasicBlockGraph());
+    }
+    // -db-entry: the blocks are read with the rest of their function
+    if (DBLazyLoad())
     {
-        FunObjVar* funObjVar = item.second;
-        readBasicBlockNodesFromDB(connection, dbname, funObjVar);
+        return;
     }
 
-    for (auto& item : id2funObjVarsMap)
+    // the blocks of all functions come in one paged stream; a block carries the
+    // ids of its predecessors and successors, so the edges need no query at all
+    Map<SVFBasicBlock*, std::pair<std::string, std::string>> bb2EdgeIdsMap;
+    DBPageReader reader(connection, dbname, "MATCH (node:SVFBasicBlock)", "node", {"id(node)"});
+    readBasicBlockNodesFromDB(reader, bb2EdgeIdsMap);
+
+    for (FunObjVar* funObjVar : getLoadSession().id2funObjVarsMap)
     {
-        FunObjVar* funObjVar = item.second;
-        readBasicBlockEdgesFromDB(connection, dbname, funObjVar);
+        if (nullptr != funObjVar)
+            readBasicBlockEdgesFromDB(funObjVar, bb2EdgeIdsMap);
     }
 }
 
-void GraphDBClient::readBasicBlockNodesFromDB(lgraph::RpcClient* connection, const std::string& dbname, FunObjVar* funObjVar)
+void GraphDBClient::readBasicBlockNodesFromDB(DBPageReader& reader,
+                                              Map<SVFBasicBlock*, std::pair<std::string, std::string>>& bb2EdgeIdsMap)
 {
-        NodeID funObjId = funObjVar->getId();
-        std::string queryStatement ="MATCH (node) where node.fun_obj_var_id = " + std::to_string(funObjId) +" RETURN node ";
-        cJSON* root = queryFromDB(connection, dbname, queryStatement);
-        if (nullptr != root)
+    while (true)
+    {
+        DBResult* root = reader.next();
+        if (nullptr == root)
+        {
+            break;
+        }
+        for (const DBValue* node : *root)
         {
-            cJSON* node;
-            BasicBlockGraph* bbGraph = new BasicBlockGraph();
-            funObjVar->setBasicBlockGraph(bbGraph);
-            cJSON_ArrayForEach(node, root)
+            const DBValue* data = node->get(DB_FIELD("node"));
+            if (!data)
+                continue;
+            const DBValue* properties = data->get(DB_FIELD("properties"));
+            if (!properties)
+                continue;
+            int fun_obj_var_id = properties->getInt(DB_FIELD("fun_obj_var_id"));
+            FunObjVar* funObjVar = getLoadSession().id2funObjVarsMap.find(fun_obj_var_id);
+            if (nullptr == funObjVar)
             {
-                cJSON* data = cJSON_GetObjectItem(node, "node");
-                if (!data)
-                    continue;
-                cJSON* properties = cJSON_GetObjectItem(data, "properties");
-                if (!properties)
-                    continue;
-                std::string id = cJSON_GetObjectItem(properties, "id")->valuestring;
-                std::string bb_name =
-                    cJSON_GetObjectItem(properties, "bb_name")->valuestring;
-                int bbId = parseBBId(id);
-                SVFBasicBlock* bb = new SVFBasicBlock(bbId, funObjVar);
-                bb->setName(bb_name);
-                bbGraph->addBasicBlock(bb);
-                bbGraph->id++;
-                basicBlocks.insert(bb);
-                std::string allICFGNodeIds = cJSON_GetObjectItem(properties, "all_icfg_nodes_ids")->valuestring;
-                if (!allICFGNodeIds.empty())
-                    bb2AllICFGNodeIdstrMap.insert(std::make_pair(bb, allICFGNodeIds));
+                SVFUtil::outs() << "Warning: [readBasicBlockNodesFromDB] No matching FunObjVar found for id: " << fun_obj_var_id << "\n";
+                continue;
             }
-            cJSON_Delete(root);
-        }   
-    
+            BasicBlockGraph* bbGraph = funObjVar->getBasicBlockGraph();
+            std::string id = properties->getString(DB_FIELD("id"));
+            std::string bb_name =
+                properties->getString(DB_FIELD("bb_name"));
+            int bbId = parseBBId(id);
+            SVFBasicBlock* bb = new SVFBasicBlock(bbId, funObjVar);
+            bb->setName(bb_name);
+            bbGraph->addBasicBlock(bb);
+            bbGraph->id++;
+            std::string allICFGNodeIds = properties->getString(DB_FIELD("all_icfg_nodes_ids"));
+            if (!allICFGNodeIds.empty())
+                getLoadSession().bb2AllICFGNodeIdstrMap.insert(std::make_pair(bb, allICFGNodeIds));
+            bb2EdgeIdsMap[bb] = std::make_pair(properties->getString(DB_FIELD("pred_bb_ids")),
+                                               properties->getString(DB_FIELD("sscc_bb_ids")));
+        }
+        delete root;
+    }
 }
 
 void GraphDBClient::updateBasicBlockNodes(ICFG* icfg)
 {
-    for (auto& item:bb2AllICFGNodeIdstrMap)
+    DBLoadSession& refs = getLoadSession();
+    for (auto& item:refs.bb2AllICFGNodeIdstrMap)
     {
         SVFBasicBlock* bb = item.first;
         std::string allICFGNodeIds = item.second;
@@ -3113,58 +4758,48 @@ void GraphDBClient::updateBasicBlockNodes(ICFG* icfg)
             }
         }
     }
+    // -db-entry calls this again for the blocks of each load
+    refs.bb2AllICFGNodeIdstrMap.clear();
 }
 
-void GraphDBClient::readBasicBlockEdgesFromDB(lgraph::RpcClient* connection, const std::string& dbname, FunObjVar* funObjVar)
+void GraphDBClient::readBasicBlockEdgesFromDB(FunObjVar* funObjVar,
+                                              const Map<SVFBasicBlock*, std::pair<std::string, std::string>>& bb2EdgeIdsMap)
 {
     BasicBlockGraph* bbGraph = funObjVar->getBasicBlockGraph();
     if (nullptr != bbGraph)
     {
         for (auto& pair: *bbGraph)
         {
-                SVFBasicBlock* bb = pair.second;
-                std::string queryStatement = "MATCH (node{id:'"+std::to_string(bb->getId())+":"+std::to_string(bb->getFunction()->getId())+"'}) RETURN node.pred_bb_ids, node.sscc_bb_ids ";
-                cJSON* root = queryFromDB(connection, dbname, queryStatement);
-                if (nullptr != root)
+            SVFBasicBlock* bb = pair.second;
+            auto it = bb2EdgeIdsMap.find(bb);
+            if (it == bb2EdgeIdsMap.end())
+                continue;
+            std::string pred_bb_ids = it->second.first;
+            std::string sscc_bb_ids = it->second.second;
+            if (!pred_bb_ids.empty())
+            {
+                std::vector<int> predBBIds = parseElements2Container<std::vector<int>>(pred_bb_ids);
+                for (int predBBId : predBBIds)
                 {
-                    cJSON* item;
-                    cJSON_ArrayForEach(item, root)
+                    SVFBasicBlock* predBB = bbGraph->getGNode(predBBId);
+                    if (nullptr != predBB)
                     {
-                        if (!item)
-                            continue;
-                        std::string pred_bb_ids = cJSON_GetObjectItem(item, "node.pred_bb_ids")->valuestring;
-                        std::string sscc_bb_ids = cJSON_GetObjectItem(item, "node.sscc_bb_ids")->valuestring;
-                        if (!pred_bb_ids.empty())
-                        {
-                            std::vector<int> predBBIds = parseElements2Container<std::vector<int>>(pred_bb_ids);
-                            for (int predBBId : predBBIds)
-                            {
-    
-                                SVFBasicBlock* predBB = bbGraph->getGNode(predBBId);
-                                if (nullptr != predBB)
-                                {
-                                    bb->addPredBasicBlock(predBB);
-                                }
-    
-                            }
-                        }
-                        if (!sscc_bb_ids.empty())
-                        {
-                            std::vector<int> ssccBBIds = parseElements2Container<std::vector<int>>(sscc_bb_ids);
-                            for (int ssccBBId : ssccBBIds)
-                            {
-                                SVFBasicBlock* ssccBB = bbGraph->getGNode(ssccBBId);
-                                if (nullptr != ssccBB)
-                                {
-                                    bb->addSuccBasicBlock(ssccBB);
-                                }
-    
-                            }
-                        }
+                        bb->addPredBasicBlock(predBB);
                     }
-                    cJSON_Delete(root);
                 }
-                    
+            }
+            if (!sscc_bb_ids.empty())
+            {
+                std::vector<int> ssccBBIds = parseElements2Container<std::vector<int>>(sscc_bb_ids);
+                for (int ssccBBId : ssccBBIds)
+                {
+                    SVFBasicBlock* ssccBB = bbGraph->getGNode(ssccBBId);
+                    if (nullptr != ssccBB)
+                    {
+                        bb->addSuccBasicBlock(ssccBB);
+                    }
+                }
+            }
         }
     }
 }
@@ -3174,8 +4809,16 @@ ICFG* GraphDBClient::buildICFGFromDB(lgraph::RpcClient* connection, const std::s
     SVFUtil::outs()<< "Build ICFG from DB....\n";
     DBOUT(DGENERAL, outs() << pasMsg("\t Building ICFG From DB ...\n"));
     ICFG* icfg = new ICFG();
+    std::vector<std::string> icfgNodeTypes = funICFGNodeTypes;
+    icfgNodeTypes.push_back("GlobalICFGNode");
+    getLoadSession().id2RetICFGNodeMap.reserve(readRowCountFromDB(connection, dbname, icfgNodeTypes, false));
     // read & add all the ICFG nodes from DB
     readICFGNodesFromDB(connection, dbname, "GlobalICFGNode", icfg, pag);
+    // -db-entry: the other nodes and the edges are read with their functions
+    if (DBLazyLoad())
+    {
+        return icfg;
+    }
     readICFGNodesFromDB(connection, dbname, "FunEntryICFGNode", icfg, pag);
     readICFGNodesFromDB(connection, dbname, "FunExitICFGNode", icfg, pag);
     readICFGNodesFromDB(connection, dbname, "IntraICFGNode", icfg, pag);
@@ -3195,20 +4838,22 @@ ICFG* GraphDBClient::buildICFGFromDB(lgraph::RpcClient* connection, const std::s
 
 void GraphDBClient::readICFGNodesFromDB(lgraph::RpcClient* connection, const std::string& dbname, std::string nodeType, ICFG* icfg, SVFIR* pag)
 {
-    int skip = 0;
-    int limit = 1000;
+    DBPageReader reader(connection, dbname, "MATCH (node:"+nodeType+")", "node", {"node.id"});
+    readICFGNodesFromDB(reader, nodeType, icfg, pag);
+}
+
+void GraphDBClient::readICFGNodesFromDB(DBPageReader& reader, std::string nodeType, ICFG* icfg, SVFIR* pag)
+{
     while (true)
     {
-        std::string queryStatement = " MATCH (node:"+nodeType+") RETURN node SKIP "+std::to_string(skip)+" LIMIT "+std::to_string(limit);
-        cJSON* root = queryFromDB(connection, dbname, queryStatement);
+        DBResult* root = reader.next();
         if (nullptr == root)
         {
             break;
         }
         else
         {
-            cJSON* node;
-            cJSON_ArrayForEach(node, root)
+            for (const DBValue* node : *root)
             {
                 ICFGNode* icfgNode = nullptr;
                 if (nodeType == "GlobalICFGNode")
@@ -3250,7 +4895,7 @@ void GraphDBClient::readICFGNodesFromDB(lgraph::RpcClient* connection, const std
                     if (nullptr != icfgNode)
                     {
                         icfg->addICFGNode(icfgNode);
-                        id2RetICFGNodeMap[icfgNode->getId()] = SVFUtil::cast<RetICFGNode>(icfgNode);
+                        getLoadSession().id2RetICFGNodeMap.set(icfgNode->getId(), SVFUtil::cast<RetICFGNode>(icfgNode));
                     }
                 }
                 else if (nodeType == "CallICFGNode")
@@ -3288,18 +4933,18 @@ void GraphDBClient::readICFGNodesFromDB(lgraph::RpcClient* connection, const std
                 {
                     SVFUtil::outs()<< "Failed to create "<< nodeType<< " from db query result\n";
                 }
-                skip += 1;
             }
-            cJSON_Delete(root);
+            delete root;
         }
     }
 }
 
 void GraphDBClient::parseSVFStmtsForICFGNodeFromDBResult(SVFIR* pag)
 {
-    if (!icfgNode2StmtsStrMap.empty())
+    DBLoadSession& refs = getLoadSession();
+    if (!refs.icfgNode2StmtsStrMap.empty())
     {
-        for (auto& pair : icfgNode2StmtsStrMap)
+        for (auto& pair : refs.icfgNode2StmtsStrMap)
         {
             ICFGNode* icfgNode = pair.first;
             std::string svfStmtIds = pair.second;
@@ -3308,7 +4953,7 @@ void GraphDBClient::parseSVFStmtsForICFGNodeFromDBResult(SVFIR* pag)
                 std::list<int> svfStmtIdsVec = parseElements2Container<std::list<int>>(svfStmtIds);
                 for (int stmtId : svfStmtIdsVec)
                 {
-                    SVFStmt* stmt = edgeId2SVFStmtMap[stmtId];
+                    SVFStmt* stmt = getLoadSession().edgeId2SVFStmtMap.find(stmtId);
                     if (stmt != nullptr)
                     {
                         pag->addToSVFStmtList(icfgNode,stmt);
@@ -3322,29 +4967,31 @@ void GraphDBClient::parseSVFStmtsForICFGNodeFromDBResult(SVFIR* pag)
             }
         }
     }
+    // -db-entry calls this again for the ICFG nodes of each load
+    refs.icfgNode2StmtsStrMap.clear();
 }
 
-ICFGNode* GraphDBClient::parseGlobalICFGNodeFromDBResult(const cJSON* node, SVFIR* pag)
+ICFGNode* GraphDBClient::parseGlobalICFGNodeFromDBResult(const DBValue* node, SVFIR* pag)
 {
-    cJSON* data = cJSON_GetObjectItem(node, "node");
+    const DBValue* data = node->get(DB_FIELD("node"));
     if (!data)
         return nullptr;
 
-    cJSON* properties = cJSON_GetObjectItem(data, "properties");
+    const DBValue* properties = data->get(DB_FIELD("properties"));
     if (!properties)
         return nullptr;
 
     GlobalICFGNode* icfgNode;
-    int id = cJSON_GetObjectItem(properties,"id")->valueint;
+    int id = properties->getInt(DB_FIELD("id"));
 
     icfgNode = new GlobalICFGNode(id);
-    std::string svfStmtIds = cJSON_GetObjectItem(properties, "pag_edge_ids")->valuestring;
+    std::string svfStmtIds = properties->getString(DB_FIELD("pag_edge_ids"));
     if (!svfStmtIds.empty())
     {
-        icfgNode2StmtsStrMap[icfgNode] = svfStmtIds;
+        getLoadSession().icfgNode2StmtsStrMap[icfgNode] = svfStmtIds;
     }
 
-    cJSON* dataNode = cJSON_GetObjectItem(properties, "chnodes_ids");
+    const DBValue* dataNode = properties->get(DB_FIELD("chnodes_ids"));
     std::string chnodes_ids = "";
     if (nullptr != dataNode->valuestring)
         chnodes_ids = dataNode->valuestring;
@@ -3353,7 +5000,7 @@ ICFGNode* GraphDBClient::parseGlobalICFGNodeFromDBResult(const cJSON* node, SVFI
         Set<int> chnodesIds = parseElements2Container<Set<int> >(chnodes_ids);
         updateCallNode2ClassesMap(icfgNode, chnodesIds, SVFUtil::cast<CHGraph>(pag->getCHG()));
     }
-    dataNode = cJSON_GetObjectItem(properties, "cha_vtbls_ids");
+    dataNode = properties->get(DB_FIELD("cha_vtbls_ids"));
     std::string cha_vtbls_ids = "";
     if (nullptr != dataNode->valuestring)
         cha_vtbls_ids = dataNode->valuestring;
@@ -3365,32 +5012,27 @@ ICFGNode* GraphDBClient::parseGlobalICFGNodeFromDBResult(const cJSON* node, SVFI
     return icfgNode;
 }
 
-ICFGNode* GraphDBClient::parseFunEntryICFGNodeFromDBResult(const cJSON* node, SVFIR* pag)
+ICFGNode* GraphDBClient::parseFunEntryICFGNodeFromDBResult(const DBValue* node, SVFIR* pag)
 {
-    cJSON* data = cJSON_GetObjectItem(node, "node");
+    const DBValue* data = node->get(DB_FIELD("node"));
     if (!data)
         return nullptr;
 
-    cJSON* properties = cJSON_GetObjectItem(data, "properties");
+    const DBValue* properties = data->get(DB_FIELD("properties"));
     if (!properties)
         return nullptr;
 
     FunEntryICFGNode* icfgNode;
-    int id = cJSON_GetObjectItem(properties,"id")->valueint;
-    int fun_obj_var_id = cJSON_GetObjectItem(properties, "fun_obj_var_id")->valueint; 
-    FunObjVar* funObjVar = nullptr;
-    auto funObjVarIt = id2funObjVarsMap.find(fun_obj_var_id);
-    if (funObjVarIt != id2funObjVarsMap.end())
-    {
-        funObjVar = funObjVarIt->second;
-    }
-    else
+    int id = properties->getInt(DB_FIELD("id"));
+    int fun_obj_var_id = properties->getInt(DB_FIELD("fun_obj_var_id")); 
+    FunObjVar* funObjVar = getLoadSession().id2funObjVarsMap.find(fun_obj_var_id);
+    if (nullptr == funObjVar)
     {
         SVFUtil::outs() << "Warning: [parseFunEntryICFGNodeFromDBResult] No matching FunObjVar found for id: " << fun_obj_var_id << "\n";
     }
 
     icfgNode = new FunEntryICFGNode(id, funObjVar);
-    std::string fpNodesStr = cJSON_GetObjectItem(properties, "fp_nodes")->valuestring;
+    std::string fpNodesStr = properties->getString(DB_FIELD("fp_nodes"));
     std::vector<u32_t> fpNodesIdVec = parseElements2Container<std::vector<u32_t>>(fpNodesStr);
     for (auto fpNodeId: fpNodesIdVec)
     {
@@ -3405,13 +5047,13 @@ ICFGNode* GraphDBClient::parseFunEntryICFGNodeFromDBResult(const cJSON* node, SV
         }
     }
 
-    std::string svfStmtIds = cJSON_GetObjectItem(properties, "pag_edge_ids")->valuestring;
+    std::string svfStmtIds = properties->getString(DB_FIELD("pag_edge_ids"));
     if (!svfStmtIds.empty())
     {
-        icfgNode2StmtsStrMap[icfgNode] = svfStmtIds;
+        getLoadSession().icfgNode2StmtsStrMap[icfgNode] = svfStmtIds;
     }
 
-    cJSON* dataNode = cJSON_GetObjectItem(properties, "chnodes_ids");
+    const DBValue* dataNode = properties->get(DB_FIELD("chnodes_ids"));
     std::string chnodes_ids = "";
     if (nullptr != dataNode->valuestring)
         chnodes_ids = dataNode->valuestring;
@@ -3420,7 +5062,7 @@ ICFGNode* GraphDBClient::parseFunEntryICFGNodeFromDBResult(const cJSON* node, SV
         Set<int> chnodesIds = parseElements2Container<Set<int> >(chnodes_ids);
         updateCallNode2ClassesMap(icfgNode, chnodesIds, SVFUtil::cast<CHGraph>(pag->getCHG()));
     }
-    dataNode = cJSON_GetObjectItem(properties, "cha_vtbls_ids");
+    dataNode = properties->get(DB_FIELD("cha_vtbls_ids"));
     std::string cha_vtbls_ids = "";
     if (nullptr != dataNode->valuestring)
         cha_vtbls_ids = dataNode->valuestring;
@@ -3432,37 +5074,32 @@ ICFGNode* GraphDBClient::parseFunEntryICFGNodeFromDBResult(const cJSON* node, SV
     return icfgNode;
 }
 
-ICFGNode* GraphDBClient::parseFunExitICFGNodeFromDBResult(const cJSON* node, SVFIR* pag)
+ICFGNode* GraphDBClient::parseFunExitICFGNodeFromDBResult(const DBValue* node, SVFIR* pag)
 {
-    cJSON* data = cJSON_GetObjectItem(node, "node");
+    const DBValue* data = node->get(DB_FIELD("node"));
     if (!data)
         return nullptr;
 
-    cJSON* properties = cJSON_GetObjectItem(data, "properties");
+    const DBValue* properties = data->get(DB_FIELD("properties"));
     if (!properties)
         return nullptr;
 
     FunExitICFGNode* icfgNode;
-    int id = cJSON_GetObjectItem(properties,"id")->valueint;
+    int id = properties->getInt(DB_FIELD("id"));
 
-    int fun_obj_var_id = cJSON_GetObjectItem(properties, "fun_obj_var_id")->valueint;
-    FunObjVar* funObjVar = nullptr;
-    auto funObjVarIt = id2funObjVarsMap.find(fun_obj_var_id);
-    if (funObjVarIt != id2funObjVarsMap.end())
-    {
-        funObjVar = funObjVarIt->second;
-    }
-    else
+    int fun_obj_var_id = properties->getInt(DB_FIELD("fun_obj_var_id"));
+    FunObjVar* funObjVar = getLoadSession().id2funObjVarsMap.find(fun_obj_var_id);
+    if (nullptr == funObjVar)
     {
         SVFUtil::outs() << "Warning: [parseFunExitICFGNodeFromDBResult] No matching FunObjVar found for id: " << fun_obj_var_id << "\n";
     }
 
     // parse FunExitICFGNode bb
-    int bb_id = cJSON_GetObjectItem(properties, "bb_id")->valueint;
+    int bb_id = properties->getInt(DB_FIELD("bb_id"));
     const SVFBasicBlock* bb = funObjVar->getBasicBlockGraph()->getGNode(bb_id);
 
     icfgNode = new FunExitICFGNode(id, funObjVar, bb);
-    int formal_ret_node_id = cJSON_GetObjectItem(properties, "formal_ret_node_id")->valueint;
+    int formal_ret_node_id = properties->getInt(DB_FIELD("formal_ret_node_id"));
     if (formal_ret_node_id != -1)
     {
         SVFVar* formalRet = pag->getGNode(formal_ret_node_id);
@@ -3485,13 +5122,13 @@ ICFGNode* GraphDBClient::parseFunExitICFGNodeFromDBResult(const cJSON* node, SVF
     //     SVFUtil::outs() << "Warning: [parseFunExitICFGNodeFromDBResult] No matching BasicBlock found for id: " << bb_id << "\n";
     // }
 
-    std::string svfStmtIds = cJSON_GetObjectItem(properties, "pag_edge_ids")->valuestring;
+    std::string svfStmtIds = properties->getString(DB_FIELD("pag_edge_ids"));
     if (!svfStmtIds.empty())
     {
-        icfgNode2StmtsStrMap[icfgNode] = svfStmtIds;
+        getLoadSession().icfgNode2StmtsStrMap[icfgNode] = svfStmtIds;
     }
     
-    cJSON* dataNode = cJSON_GetObjectItem(properties, "chnodes_ids");
+    const DBValue* dataNode = properties->get(DB_FIELD("chnodes_ids"));
     std::string chnodes_ids = "";
     if (nullptr != dataNode->valuestring)
         chnodes_ids = dataNode->valuestring;
@@ -3500,7 +5137,7 @@ ICFGNode* GraphDBClient::parseFunExitICFGNodeFromDBResult(const cJSON* node, SVF
         Set<int> chnodesIds = parseElements2Container<Set<int> >(chnodes_ids);
         updateCallNode2ClassesMap(icfgNode, chnodesIds, SVFUtil::cast<CHGraph>(pag->getCHG()));
     }
-    dataNode = cJSON_GetObjectItem(properties, "cha_vtbls_ids");
+    dataNode = properties->get(DB_FIELD("cha_vtbls_ids"));
     std::string cha_vtbls_ids = "";
     if (nullptr != dataNode->valuestring)
         cha_vtbls_ids = dataNode->valuestring;
@@ -3511,48 +5148,43 @@ ICFGNode* GraphDBClient::parseFunExitICFGNodeFromDBResult(const cJSON* node, SVF
     }    return icfgNode;
 }
 
-ICFGNode* GraphDBClient::parseIntraICFGNodeFromDBResult(const cJSON* node, SVFIR* pag)
+ICFGNode* GraphDBClient::parseIntraICFGNodeFromDBResult(const DBValue* node, SVFIR* pag)
 {
-    cJSON* data = cJSON_GetObjectItem(node, "node");
+    const DBValue* data = node->get(DB_FIELD("node"));
     if (!data)
         return nullptr;
 
-    cJSON* properties = cJSON_GetObjectItem(data, "properties");
+    const DBValue* properties = data->get(DB_FIELD("properties"));
     if (!properties)
         return nullptr;
 
     IntraICFGNode* icfgNode;
-    int id = cJSON_GetObjectItem(properties, "id")->valueint;
+    int id = properties->getInt(DB_FIELD("id"));
     // parse intraICFGNode funObjVar
-    int fun_obj_var_id = cJSON_GetObjectItem(properties, "fun_obj_var_id")->valueint;
-    FunObjVar* funObjVar = nullptr;
-    auto funObjVarIt = id2funObjVarsMap.find(fun_obj_var_id);
-    if (funObjVarIt != id2funObjVarsMap.end())
-    {
-        funObjVar = funObjVarIt->second;
-    }
-    else
+    int fun_obj_var_id = properties->getInt(DB_FIELD("fun_obj_var_id"));
+    FunObjVar* funObjVar = getLoadSession().id2funObjVarsMap.find(fun_obj_var_id);
+    if (nullptr == funObjVar)
     {
         SVFUtil::outs() << "Warning: [parseIntraICFGNodeFromDBResult] No matching FunObjVar found for id: " << fun_obj_var_id << "\n";
     }
 
     // parse intraICFGNode bb
-    int bb_id = cJSON_GetObjectItem(properties, "bb_id")->valueint;
+    int bb_id = properties->getInt(DB_FIELD("bb_id"));
     SVFBasicBlock* bb = funObjVar->getBasicBlockGraph()->getGNode(bb_id);
 
     // parse isRet 
-    bool is_return = cJSON_IsTrue(cJSON_GetObjectItem(properties, "is_return"));
+    bool is_return = properties->getBool(DB_FIELD("is_return"));
 
     
     icfgNode = new IntraICFGNode(id, bb, is_return);
     
-    std::string svfStmtIds = cJSON_GetObjectItem(properties, "pag_edge_ids")->valuestring;
+    std::string svfStmtIds = properties->getString(DB_FIELD("pag_edge_ids"));
     if (!svfStmtIds.empty())
     {
-        icfgNode2StmtsStrMap[icfgNode] = svfStmtIds;
+        getLoadSession().icfgNode2StmtsStrMap[icfgNode] = svfStmtIds;
     }
         
-    cJSON* dataNode = cJSON_GetObjectItem(properties, "chnodes_ids");
+    const DBValue* dataNode = properties->get(DB_FIELD("chnodes_ids"));
     std::string chnodes_ids = "";
     if (nullptr != dataNode->valuestring)
         chnodes_ids = dataNode->valuestring;
@@ -3561,7 +5193,7 @@ ICFGNode* GraphDBClient::parseIntraICFGNodeFromDBResult(const cJSON* node, SVFIR
         Set<int> chnodesIds = parseElements2Container<Set<int> >(chnodes_ids);
         updateCallNode2ClassesMap(icfgNode, chnodesIds, SVFUtil::cast<CHGraph>(pag->getCHG()));
     }
-    dataNode = cJSON_GetObjectItem(properties, "cha_vtbls_ids");
+    dataNode = properties->get(DB_FIELD("cha_vtbls_ids"));
     std::string cha_vtbls_ids = "";
     if (nullptr != dataNode->valuestring)
         cha_vtbls_ids = dataNode->valuestring;
@@ -3572,39 +5204,34 @@ ICFGNode* GraphDBClient::parseIntraICFGNodeFromDBResult(const cJSON* node, SVFIR
     }    return icfgNode;
 }
 
-ICFGNode* GraphDBClient::parseRetICFGNodeFromDBResult(const cJSON* node, SVFIR* pag)
+ICFGNode* GraphDBClient::parseRetICFGNodeFromDBResult(const DBValue* node, SVFIR* pag)
 {
-    cJSON* data = cJSON_GetObjectItem(node, "node");
+    const DBValue* data = node->get(DB_FIELD("node"));
     if (!data)
         return nullptr;
 
-    cJSON* properties = cJSON_GetObjectItem(data, "properties");
+    const DBValue* properties = data->get(DB_FIELD("properties"));
     if (!properties)
         return nullptr;
     
     RetICFGNode* icfgNode;
     // parse retICFGNode id
-    int id = cJSON_GetObjectItem(properties, "id")->valueint;
+    int id = properties->getInt(DB_FIELD("id"));
 
     // parse retICFGNode funObjVar
-    int fun_obj_var_id = cJSON_GetObjectItem(properties, "fun_obj_var_id")->valueint;
-    FunObjVar* funObjVar = nullptr;
-    auto funObjVarIt = id2funObjVarsMap.find(fun_obj_var_id);
-    if (funObjVarIt != id2funObjVarsMap.end())
-    {
-        funObjVar = funObjVarIt->second;
-    }
-    else
+    int fun_obj_var_id = properties->getInt(DB_FIELD("fun_obj_var_id"));
+    FunObjVar* funObjVar = getLoadSession().id2funObjVarsMap.find(fun_obj_var_id);
+    if (nullptr == funObjVar)
     {
         SVFUtil::outs() << "Warning: [parseRetICFGNodeFromDBResult] No matching FunObjVar found for id: " << fun_obj_var_id << "\n";
     }
 
     // parse retICFGNode bb
-    int bb_id = cJSON_GetObjectItem(properties, "bb_id")->valueint;
+    int bb_id = properties->getInt(DB_FIELD("bb_id"));
     SVFBasicBlock* bb = funObjVar->getBasicBlockGraph()->getGNode(bb_id);
 
     // parse retICFGNode svfType
-    int svfTypeId = cJSON_GetObjectItem(properties, "svf_type_id")->valueint;
+    int svfTypeId = properties->getInt(DB_FIELD("svf_type_id"));
     const SVFType* type = pag->getSVFType(svfTypeId);
     if (nullptr == type)
     {
@@ -3618,7 +5245,7 @@ ICFGNode* GraphDBClient::parseRetICFGNodeFromDBResult(const cJSON* node, SVFIR*
     icfgNode->fun = funObjVar;
 
     // parse & add actualRet for RetICFGNode
-    int actual_ret_node_id = cJSON_GetObjectItem(properties, "actual_ret_node_id")->valueint;
+    int actual_ret_node_id = properties->getInt(DB_FIELD("actual_ret_node_id"));
     if (actual_ret_node_id != -1)
     {
         SVFVar* actualRet = pag->getGNode(actual_ret_node_id);
@@ -3642,13 +5269,13 @@ ICFGNode* GraphDBClient::parseRetICFGNodeFromDBResult(const cJSON* node, SVFIR*
     //     SVFUtil::outs() << "Warning: [parseRetICFGNodeFromDBResult] No matching BasicBlock found for id: " << bb_id << "\n";
     // }
 
-    std::string svfStmtIds = cJSON_GetObjectItem(properties, "pag_edge_ids")->valuestring;
+    std::string svfStmtIds = properties->getString(DB_FIELD("pag_edge_ids"));
     if (!svfStmtIds.empty())
     {
-        icfgNode2StmtsStrMap[icfgNode] = svfStmtIds;
+        getLoadSession().icfgNode2StmtsStrMap[icfgNode] = svfStmtIds;
     }
     
-    cJSON* dataNode = cJSON_GetObjectItem(properties, "chnodes_ids");
+    const DBValue* dataNode = properties->get(DB_FIELD("chnodes_ids"));
     std::string chnodes_ids = "";
     if (nullptr != dataNode->valuestring)
         chnodes_ids = dataNode->valuestring;
@@ -3657,7 +5284,7 @@ ICFGNode* GraphDBClient::parseRetICFGNodeFromDBResult(const cJSON* node, SVFIR*
         Set<int> chnodesIds = parseElements2Container<Set<int> >(chnodes_ids);
         updateCallNode2ClassesMap(icfgNode, chnodesIds, SVFUtil::cast<CHGraph>(pag->getCHG()));
     }
-    dataNode = cJSON_GetObjectItem(properties, "cha_vtbls_ids");
+    dataNode = properties->get(DB_FIELD("cha_vtbls_ids"));
     std::string cha_vtbls_ids = "";
     if (nullptr != dataNode->valuestring)
         cha_vtbls_ids = dataNode->valuestring;
@@ -3668,40 +5295,36 @@ ICFGNode* GraphDBClient::parseRetICFGNodeFromDBResult(const cJSON* node, SVFIR*
     }    return icfgNode;
 }
 
-ICFGNode* GraphDBClient::parseCallICFGNodeFromDBResult(const cJSON* node, SVFIR* pag)
+ICFGNode* GraphDBClient::parseCallICFGNodeFromDBResult(const DBValue* node, SVFIR* pag)
 {
-    cJSON* data = cJSON_GetObjectItem(node, "node");
+    DBLoadSession& session = getLoadSession();
+    const DBValue* data = node->get(DB_FIELD("node"));
     if (!data)
         return nullptr;
 
-    cJSON* properties = cJSON_GetObjectItem(data, "properties");
+    const DBValue* properties = data->get(DB_FIELD("properties"));
     if (!properties)
         return nullptr;
     
     CallICFGNode* icfgNode;
 
     // parse CallICFGNode id
-    int id = cJSON_GetObjectItem(properties, "id")->valueint;
+    int id = properties->getInt(DB_FIELD("id"));
 
     // parse CallICFGNode funObjVar
-    int fun_obj_var_id = cJSON_GetObjectItem(properties, "fun_obj_var_id")->valueint;
-    FunObjVar* funObjVar = nullptr;
-    auto funObjVarIt = id2funObjVarsMap.find(fun_obj_var_id);
-    if (funObjVarIt != id2funObjVarsMap.end())
-    {
-        funObjVar = funObjVarIt->second;
-    }
-    else
+    int fun_obj_var_id = properties->getInt(DB_FIELD("fun_obj_var_id"));
+    FunObjVar* funObjVar = session.id2funObjVarsMap.find(fun_obj_var_id);
+    if (nullptr == funObjVar)
     {
         SVFUtil::outs() << "Warning: [parseCallICFGNodeFromDBResult] No matching FunObjVar found for id: " << fun_obj_var_id << "\n";
     }
 
     // parse CallICFGNode bb
-    int bb_id = cJSON_GetObjectItem(properties, "bb_id")->valueint;
+    int bb_id = properties->getInt(DB_FIELD("bb_id"));
     SVFBasicBlock* bb = funObjVar->getBasicBlockGraph()->getGNode(bb_id);
 
     // parse CallICFGNode svfType
-    int svfTypeId = cJSON_GetObjectItem(properties, "svf_type_id")->valueint;
+    int svfTypeId = properties->getInt(DB_FIELD("svf_type_id"));
     const SVFType* type = pag->getSVFType(svfTypeId);
     if (nullptr == type)
     {
@@ -3709,35 +5332,27 @@ ICFGNode* GraphDBClient::parseCallICFGNodeFromDBResult(const cJSON* node, SVFIR*
     }
 
     // parse CallICFGNode calledFunObjVar
-    int called_fun_obj_var_id = cJSON_GetObjectItem(properties, "called_fun_obj_var_id")->valueint;
+    int called_fun_obj_var_id = properties->getInt(DB_FIELD("called_fun_obj_var_id"));
     FunObjVar* calledFunc = nullptr;
     if (called_fun_obj_var_id != -1)
     {
-        auto calledFuncIt = id2funObjVarsMap.find(called_fun_obj_var_id);
-        if (calledFuncIt != id2funObjVarsMap.end())
-        {
-            calledFunc = calledFuncIt->second;
-        }
-        else
+        calledFunc = session.id2funObjVarsMap.find(called_fun_obj_var_id);
+        if (nullptr == calledFunc)
         {
             SVFUtil::outs() << "Warning: [parseCallICFGNodeFromDBResult] No matching calledFunObjVar found for id: " << called_fun_obj_var_id << "\n";
         }
     }
 
-    bool is_vararg = cJSON_IsTrue(cJSON_GetObjectItem(properties, "is_vararg"));
-    bool is_vir_call_inst = cJSON_IsTrue(cJSON_GetObjectItem(properties, "is_vir_call_inst"));
+    bool is_vararg = properties->getBool(DB_FIELD("is_vararg"));
+    bool is_vir_call_inst = properties->getBool(DB_FIELD("is_vir_call_inst"));
 
     // parse CallICFGNode retICFGNode
-    int ret_icfg_node_id = cJSON_GetObjectItem(properties, "ret_icfg_node_id")->valueint;
+    int ret_icfg_node_id = properties->getInt(DB_FIELD("ret_icfg_node_id"));
     RetICFGNode* retICFGNode = nullptr;
     if (ret_icfg_node_id != -1)
     {
-        auto retICFGNodeIt = id2RetICFGNodeMap.find(ret_icfg_node_id);
-        if (retICFGNodeIt != id2RetICFGNodeMap.end())
-        {
-            retICFGNode = retICFGNodeIt->second;
-        }
-        else
+        retICFGNode = session.id2RetICFGNodeMap.find(ret_icfg_node_id);
+        if (nullptr == retICFGNode)
         {
             SVFUtil::outs() << "Warning: [parseCallICFGNodeFromDBResult] No matching RetICFGNode found for id: " << ret_icfg_node_id << "\n";
         }
@@ -3748,11 +5363,11 @@ ICFGNode* GraphDBClient::parseCallICFGNodeFromDBResult(const cJSON* node, SVFIR*
     SVFVar* vtabPtr = nullptr;
     if (is_vir_call_inst)
     {
-        int virtual_fun_idx = cJSON_GetObjectItem(properties, "virtual_fun_idx")->valueint;
+        int virtual_fun_idx = properties->getInt(DB_FIELD("virtual_fun_idx"));
         virtualFunIdx = static_cast<s32_t>(virtual_fun_idx);
-        int vtab_ptr_node_id = cJSON_GetObjectItem(properties, "vtab_ptr_node_id")->valueint;
+        int vtab_ptr_node_id = properties->getInt(DB_FIELD("vtab_ptr_node_id"));
         vtabPtr = pag->getGNode(vtab_ptr_node_id);
-        fun_name_of_v_call = cJSON_GetObjectItem(properties, "fun_name_of_v_call")->valuestring;
+        fun_name_of_v_call = properties->getString(DB_FIELD("fun_name_of_v_call"));
     }
      
     // create CallICFGNode Instance
@@ -3762,7 +5377,7 @@ ICFGNode* GraphDBClient::parseCallICFGNodeFromDBResult(const cJSON* node, SVFIR*
     callICFGNode->setRetICFGNode(retICFGNode);
     callICFGNode->setVtablePtr(vtabPtr);
 
-    int indFunPtrId = cJSON_GetObjectItem(properties, "ind_fun_ptr_var_id")->valueint;
+    int indFunPtrId = properties->getInt(DB_FIELD("ind_fun_ptr_var_id"));
     if (indFunPtrId != -1)
     {
         SVFVar* indFunPtr = pag->getGNode(indFunPtrId);
@@ -3777,7 +5392,7 @@ ICFGNode* GraphDBClient::parseCallICFGNodeFromDBResult(const cJSON* node, SVFIR*
     }
     
     // parse CallICFGNode APNodes
-    std::string ap_nodes = cJSON_GetObjectItem(properties, "ap_nodes")->valuestring;
+    std::string ap_nodes = properties->getString(DB_FIELD("ap_nodes"));
     if (!ap_nodes.empty() && ap_nodes!= "[]")
     {
         std::vector<u32_t> apNodesIdVec = parseElements2Container<std::vector<u32_t>>(ap_nodes);
@@ -3813,13 +5428,13 @@ ICFGNode* GraphDBClient::parseCallICFGNodeFromDBResult(const cJSON* node, SVFIR*
     //     SVFUtil::outs() << "Warning: [parseCallICFGNodeFromDBResult] No matching BasicBlock found for id: " << bb_id << "\n";
     // }
     
-    std::string svfStmtIds = cJSON_GetObjectItem(properties, "pag_edge_ids")->valuestring;
+    std::string svfStmtIds = properties->getString(DB_FIELD("pag_edge_ids"));
     if (!svfStmtIds.empty())
     {
-        icfgNode2StmtsStrMap[icfgNode] = svfStmtIds;
+        session.icfgNode2StmtsStrMap[icfgNode] = svfStmtIds;
     }
     
-    cJSON* dataNode = cJSON_GetObjectItem(properties, "chnodes_ids");
+    const DBValue* dataNode = properties->get(DB_FIELD("chnodes_ids"));
     std::string chnodes_ids = "";
     if (nullptr != dataNode->valuestring)
         chnodes_ids = dataNode->valuestring;
@@ -3828,7 +5443,7 @@ ICFGNode* GraphDBClient::parseCallICFGNodeFromDBResult(const cJSON* node, SVFIR*
         Set<int> chnodesIds = parseElements2Container<Set<int> >(chnodes_ids);
         updateCallNode2ClassesMap(icfgNode, chnodesIds, SVFUtil::cast<CHGraph>(pag->getCHG()));
     }
-    dataNode = cJSON_GetObjectItem(properties, "cha_vtbls_ids");
+    dataNode = properties->get(DB_FIELD("cha_vtbls_ids"));
     std::string cha_vtbls_ids = "";
     if (nullptr != dataNode->valuestring)
         cha_vtbls_ids = dataNode->valuestring;
@@ -3841,21 +5456,42 @@ ICFGNode* GraphDBClient::parseCallICFGNodeFromDBResult(const cJSON* node, SVFIR*
 
 void GraphDBClient::readICFGEdgesFromDB(lgraph::RpcClient* connection, const std::string& dbname, std::string edgeType, ICFG* icfg, SVFIR* pag)
 {
-    int skip = 0;
-    int limit = 1000;
+    // paged on the indexed ids of the source nodes, each page expanding the
+    // edges of its nodes, instead of sorting every edge of the label per page
+    for (const std::string& srcType : icfgEdgeSrcTypes.at(edgeType))
+    {
+        DBPageReader reader(connection, dbname, "MATCH (n:" + srcType + ")", "n", {"n.id"},
+                            "OPTIONAL MATCH (n)-[edge:" + edgeType + "]->(m)", "edge");
+        readICFGEdgesFromDB(reader, edgeType, icfg, pag);
+    }
+}
+
+void GraphDBClient::readICFGEdgesFromDB(DBPageReader& reader, std::string edgeType, ICFG* icfg, SVFIR* pag)
+{
     while (true)
     {
-        std::string queryStatement =  "MATCH ()-[edge:"+edgeType+"]->() RETURN edge SKIP "+std::to_string(skip)+" LIMIT "+std::to_string(limit);
-        cJSON* root = queryFromDB(connection, dbname, queryStatement);
+        DBResult* root = reader.next();
         if (nullptr == root)
         {
             break;
         }
         else
         {
-            cJSON* edge;
-            cJSON_ArrayForEach(edge, root)
+            for (const DBValue* edge : *root)
             {
+                // a source node without such an edge
+                const DBValue* data = edge->get(DB_FIELD("edge"));
+                if (nullptr == data || data->isNull())
+                {
+                    continue;
+                }
+                // -db-entry: an edge to a function not loaded yet is read again
+                // with that function
+                if (DBLazyLoad() &&
+                    (!icfg->hasGNode(data->getInt(DB_FIELD("src"))) || !icfg->hasGNode(data->getInt(DB_FIELD("dst")))))
+                {
+                    continue;
+                }
                 ICFGEdge* icfgEdge = nullptr;
                 if (edgeType == "IntraCFGEdge")
                 {
@@ -3877,28 +5513,27 @@ void GraphDBClient::readICFGEdgesFromDB(lgraph::RpcClient* connection, const std
                 {
                     SVFUtil::outs()<< "Failed to create "<< edgeType << " from db query result\n";
                 }
-                skip += 1;
             }
-            cJSON_Delete(root);
+            delete root;
         }
     }
 }
 
-ICFGEdge* GraphDBClient::parseIntraCFGEdgeFromDBResult(const cJSON* edge, SVFIR* pag, ICFG* icfg)
+ICFGEdge* GraphDBClient::parseIntraCFGEdgeFromDBResult(const DBValue* edge, SVFIR* pag, ICFG* icfg)
 {
-    cJSON* data = cJSON_GetObjectItem(edge, "edge");
+    const DBValue* data = edge->get(DB_FIELD("edge"));
     if (!data)
         return nullptr;
 
-    cJSON* properties = cJSON_GetObjectItem(data, "properties");
+    const DBValue* properties = data->get(DB_FIELD("properties"));
     if (!properties)
         return nullptr;
 
     IntraCFGEdge* icfgEdge;
 
     // parse srcICFGNode & dstICFGNode
-    int src_id = cJSON_GetObjectItem(data,"src")->valueint;
-    int dst_id = cJSON_GetObjectItem(data,"dst")->valueint; 
+    int src_id = data->getInt(DB_FIELD("src"));
+    int dst_id = data->getInt(DB_FIELD("dst")); 
     ICFGNode* src = icfg->getICFGNode(src_id);
     ICFGNode* dst = icfg->getICFGNode(dst_id);
 
@@ -3917,8 +5552,8 @@ ICFGEdge* GraphDBClient::parseIntraCFGEdgeFromDBResult(const cJSON* edge, SVFIR*
     icfgEdge = new IntraCFGEdge(src, dst);
    
     // parse branchCondVal & conditionalVar
-    int condition_var_id = cJSON_GetObjectItem(properties, "condition_var_id")->valueint;
-    int branch_cond_val = cJSON_GetObjectItem(properties, "branch_cond_val")->valueint;
+    int condition_var_id = properties->getInt(DB_FIELD("condition_var_id"));
+    int branch_cond_val = properties->getInt(DB_FIELD("branch_cond_val"));
     s64_t branchCondVal = 0;
     SVFVar* conditionVar;
     if (condition_var_id != -1 && branch_cond_val != -1)
@@ -3936,20 +5571,20 @@ ICFGEdge* GraphDBClient::parseIntraCFGEdgeFromDBResult(const cJSON* edge, SVFIR*
     return icfgEdge;
 }
 
-ICFGEdge* GraphDBClient::parseCallCFGEdgeFromDBResult(const cJSON* edge, SVFIR* pag, ICFG* icfg)
+ICFGEdge* GraphDBClient::parseCallCFGEdgeFromDBResult(const DBValue* edge, SVFIR* pag, ICFG* icfg)
 {
-    cJSON* data = cJSON_GetObjectItem(edge, "edge");
+    const DBValue* data = edge->get(DB_FIELD("edge"));
     if (!data)
         return nullptr;
 
-    cJSON* properties = cJSON_GetObjectItem(data, "properties");
+    const DBValue* properties = data->get(DB_FIELD("properties"));
     if (!properties)
         return nullptr;
 
     CallCFGEdge* icfgEdge;
     // parse srcICFGNode & dstICFGNode
-    int src_id = cJSON_GetObjectItem(data,"src")->valueint;
-    int dst_id = cJSON_GetObjectItem(data,"dst")->valueint; 
+    int src_id = data->getInt(DB_FIELD("src"));
+    int dst_id = data->getInt(DB_FIELD("dst")); 
     ICFGNode* src = icfg->getICFGNode(src_id);
     ICFGNode* dst = icfg->getICFGNode(dst_id);
     if (src == nullptr)
@@ -3965,28 +5600,28 @@ ICFGEdge* GraphDBClient::parseCallCFGEdgeFromDBResult(const cJSON* edge, SVFIR*
 
     // create CallCFGEdge Instance
     icfgEdge = new CallCFGEdge(src, dst);
-    std::string call_pe_ids = cJSON_GetObjectItem(properties, "call_pe_ids")->valuestring;
+    std::string call_pe_ids = properties->getString(DB_FIELD("call_pe_ids"));
     if (!call_pe_ids.empty())
     {
-        callCFGEdge2CallPEStrMap[icfgEdge] = call_pe_ids;
+        getLoadSession().callCFGEdge2CallPEStrMap[icfgEdge] = call_pe_ids;
     }
     return icfgEdge;
 }
 
-ICFGEdge* GraphDBClient::parseRetCFGEdgeFromDBResult(const cJSON* edge, SVFIR* pag, ICFG* icfg)
+ICFGEdge* GraphDBClient::parseRetCFGEdgeFromDBResult(const DBValue* edge, SVFIR* pag, ICFG* icfg)
 {
-    cJSON* data = cJSON_GetObjectItem(edge, "edge");
+    const DBValue* data = edge->get(DB_FIELD("edge"));
     if (!data)
         return nullptr;
 
-    cJSON* properties = cJSON_GetObjectItem(data, "properties");
+    const DBValue* properties = data->get(DB_FIELD("properties"));
     if (!properties)
         return nullptr;
     
     RetCFGEdge* icfgEdge;
     // parse srcICFGNode & dstICFGNode
-    int src_id = cJSON_GetObjectItem(data,"src")->valueint;
-    int dst_id = cJSON_GetObjectItem(data,"dst")->valueint; 
+    int src_id = data->getInt(DB_FIELD("src"));
+    int dst_id = data->getInt(DB_FIELD("dst")); 
     ICFGNode* src = icfg->getICFGNode(src_id);
     ICFGNode* dst = icfg->getICFGNode(dst_id);
     if (src == nullptr)
@@ -4002,10 +5637,10 @@ ICFGEdge* GraphDBClient::parseRetCFGEdgeFromDBResult(const cJSON* edge, SVFIR* p
 
     // create RetCFGEdge Instance
     icfgEdge = new RetCFGEdge(src, dst);
-    int ret_pe_id = cJSON_GetObjectItem(properties, "ret_pe_id")->valueint;
+    int ret_pe_id = properties->getInt(DB_FIELD("ret_pe_id"));
     if (ret_pe_id != -1)
     {
-        retCFGEdge2RetPEStrMap[icfgEdge] = ret_pe_id;
+        getLoadSession().retCFGEdge2RetPEStrMap[icfgEdge] = ret_pe_id;
     }
     return icfgEdge;
 }
@@ -4023,41 +5658,37 @@ CHGraph* GraphDBClient::buildCHGraphFromDB(lgraph::RpcClient* connection, const
 
 void GraphDBClient::readCHNodesFromDB(lgraph::RpcClient* connection, const std::string& dbname, CHGraph* chg, SVFIR* pag)
 {
-    int skip = 0;
-    int limit = 1000;
+    DBPageReader reader(connection, dbname, "MATCH (node:CHNode)", "node", {"node.id"});
     while (true)
     {
-        std::string queryStatement = " MATCH (node:CHNode) RETURN node SKIP "+std::to_string(skip)+" LIMIT "+std::to_string(limit);
-        cJSON* root = queryFromDB(connection, dbname, queryStatement);
+        DBResult* root = reader.next();
         if (nullptr == root)
         {
             break;
         }
         else
         {
-            cJSON* node;
-            cJSON_ArrayForEach(node, root)
+            for (const DBValue* node : *root)
             {
                 parseCHNodeFromDB(node, chg, pag);
-                skip += 1;
             }
-            cJSON_Delete(root);
+            delete root;
         }
     }
 }
 
-void GraphDBClient::parseCHNodeFromDB(const cJSON* node, CHGraph* chg, SVFIR* pag)
+void GraphDBClient::parseCHNodeFromDB(const DBValue* node, CHGraph* chg, SVFIR* pag)
 {
-    cJSON* data = cJSON_GetObjectItem(node, "node");
+    const DBValue* data = node->get(DB_FIELD("node"));
     if (!data)
         return;
 
-    cJSON* properties = cJSON_GetObjectItem(data, "properties");
+    const DBValue* properties = data->get(DB_FIELD("properties"));
     if (!properties)
         return;
     
-    int id = cJSON_GetObjectItem(properties,"id")->valueint;
-    std::string className = cJSON_GetObjectItem(properties, "class_name")->valuestring;
+    int id = properties->getInt(DB_FIELD("id"));
+    std::string className = properties->getString(DB_FIELD("class_name"));
     
     // create new CHNode
     assert(!chg->getNode(className) && "this node should never be created before!");
@@ -4066,8 +5697,8 @@ void GraphDBClient::parseCHNodeFromDB(const cJSON* node, CHGraph* chg, SVFIR* pa
     chg->classNameToNodeMap[className] = chNode;
     chg->addGNode(chNode->getId(), chNode);
 
-    int vtable_id = cJSON_GetObjectItem(properties, "vtable_id")->valueint;
-    int flags = cJSON_GetObjectItem(properties, "flags")->valueint;
+    int vtable_id = properties->getInt(DB_FIELD("vtable_id"));
+    int flags = properties->getInt(DB_FIELD("flags"));
     chNode->setFlag(static_cast<SVF::CHNode::CLASSATTR>(flags));
     if (vtable_id != -1)
     {
@@ -4082,7 +5713,7 @@ void GraphDBClient::parseCHNodeFromDB(const cJSON* node, CHGraph* chg, SVFIR* pa
         }
     }
 
-    std::string virtual_function_vectors = cJSON_GetObjectItem(properties, "virtual_function_vectors")->valuestring;
+    std::string virtual_function_vectors = properties->getString(DB_FIELD("virtual_function_vectors"));
     std::vector<std::vector<const FunObjVar*>> virtualFunctionVectors = parseFuncVectorsFromString(virtual_function_vectors,pag);
     for (auto& funcVec : virtualFunctionVectors)
     {
@@ -4108,20 +5739,17 @@ CallGraph* GraphDBClient::buildCallGraphFromDB(lgraph::RpcClient* connection, co
 
 void GraphDBClient::readCallGraphNodesFromDB(lgraph::RpcClient* connection, const std::string& dbname, CallGraph* callGraph)
 {
-    int skip = 0;
-    int limit = 1000;
+    DBPageReader reader(connection, dbname, "MATCH (node:CallGraphNode)", "node", {"node.id"});
     while (true)
     {
-        std::string queryStatement = " MATCH (node:CallGraphNode) RETURN node SKIP "+std::to_string(skip)+" LIMIT "+std::to_string(limit);
-        cJSON* root = queryFromDB(connection, dbname, queryStatement);
+        DBResult* root = reader.next();
         if (nullptr == root)
         {
             break;
         }
         else
         {
-            cJSON* node;
-            cJSON_ArrayForEach(node, root)
+            for (const DBValue* node : *root)
             {
                 CallGraphNode* cgNode = nullptr;
                 cgNode = parseCallGraphNodeFromDB(node);
@@ -4129,30 +5757,34 @@ void GraphDBClient::readCallGraphNodesFromDB(lgraph::RpcClient* connection, cons
                 {
                     callGraph->addCallGraphNode(cgNode);
                 }
-                skip += 1;
             }
-            cJSON_Delete(root);
+            delete root;
         }
     }
 }
 
 void GraphDBClient::readCallGraphEdgesFromDB(lgraph::RpcClient* connection, const std::string& dbname, SVFIR* pag, CallGraph* callGraph)
 {
-    int skip = 0;
-    int limit = 1000;
+    // paged on the indexed ids of the caller nodes, each page expanding their call edges
+    DBPageReader reader(connection, dbname, "MATCH (n:CallGraphNode)", "n", {"n.id"},
+                        "OPTIONAL MATCH (n)-[edge:CallGraphEdge]->(m)", "edge");
     while (true)
     {
-        std::string queryStatement = "MATCH ()-[edge]->() RETURN edge SKIP "+std::to_string(skip)+" LIMIT "+std::to_string(limit);
-        cJSON* root = queryFromDB(connection, dbname, queryStatement);
+        DBResult* root = reader.next();
         if (nullptr == root)
         {
             break;
         }
         else
         {
-            cJSON* edge;
-            cJSON_ArrayForEach(edge, root)
+            for (const DBValue* edge : *root)
             {
+                // a function calling none
+                const DBValue* data = edge->get(DB_FIELD("edge"));
+                if (nullptr == data || data->isNull())
+                {
+                    continue;
+                }
                 CallGraphEdge* cgEdge = nullptr;
                 cgEdge = parseCallGraphEdgeFromDB(edge, pag, callGraph);
                 if (nullptr != cgEdge)
@@ -4172,34 +5804,28 @@ void GraphDBClient::readCallGraphEdgesFromDB(lgraph::RpcClient* connection, cons
                         }
                     }
                 }
-                skip += 1;
             }
-            cJSON_Delete(root);
+            delete root;
         }
     }
 }
 
-CallGraphNode* GraphDBClient::parseCallGraphNodeFromDB(const cJSON* node)
+CallGraphNode* GraphDBClient::parseCallGraphNodeFromDB(const DBValue* node)
 {
-    cJSON* data = cJSON_GetObjectItem(node, "node");
+    const DBValue* data = node->get(DB_FIELD("node"));
     if (!data)
         return nullptr;
 
-    cJSON* properties = cJSON_GetObjectItem(data, "properties");
+    const DBValue* properties = data->get(DB_FIELD("properties"));
     if (!properties)
         return nullptr;
     
-    int id = cJSON_GetObjectItem(properties,"id")->valueint;
+    int id = properties->getInt(DB_FIELD("id"));
 
     // parse funObjVar 
-    int fun_obj_var_id = cJSON_GetObjectItem(properties, "fun_obj_var_id")->valueint;
-    FunObjVar* funObjVar = nullptr;
-    auto funObjVarIt = id2funObjVarsMap.find(fun_obj_var_id);
-    if (funObjVarIt != id2funObjVarsMap.end())
-    {
-        funObjVar = funObjVarIt->second;
-    }
-    else
+    int fun_obj_var_id = properties->getInt(DB_FIELD("fun_obj_var_id"));
+    FunObjVar* funObjVar = getLoadSession().id2funObjVarsMap.find(fun_obj_var_id);
+    if (nullptr == funObjVar)
     {
         SVFUtil::outs() << "Warning: [parseCallGraphNodeFromDB] No matching FunObjVar found for id: " << fun_obj_var_id << "\n";
         return nullptr;
@@ -4209,7 +5835,7 @@ CallGraphNode* GraphDBClient::parseCallGraphNodeFromDB(const cJSON* node)
     // create callGraph node instance 
     cgNode = new CallGraphNode(id, funObjVar);
 
-    std::string sourceLocation = cJSON_GetObjectItem(properties, "source_loc")->valuestring;
+    std::string sourceLocation = properties->getString(DB_FIELD("source_loc"));
     if ( !sourceLocation.empty() )
     {
         cgNode->setSourceLoc(sourceLocation);
@@ -4218,23 +5844,23 @@ CallGraphNode* GraphDBClient::parseCallGraphNodeFromDB(const cJSON* node)
     return cgNode;
 }
 
-CallGraphEdge* GraphDBClient::parseCallGraphEdgeFromDB(const cJSON* edge, SVFIR* pag, CallGraph* callGraph)
+CallGraphEdge* GraphDBClient::parseCallGraphEdgeFromDB(const DBValue* edge, SVFIR* pag, CallGraph* callGraph)
 {
     CallGraphEdge* cgEdge = nullptr;
-    cJSON* data = cJSON_GetObjectItem(edge, "edge");
+    const DBValue* data = edge->get(DB_FIELD("edge"));
     if (!data)
         return nullptr;
 
-    cJSON* properties = cJSON_GetObjectItem(data, "properties");
+    const DBValue* properties = data->get(DB_FIELD("properties"));
     if (!properties)
         return nullptr;
 
-    int src_id = cJSON_GetObjectItem(data,"src")->valueint;
-    int dst_id = cJSON_GetObjectItem(data,"dst")->valueint;
-    int csid = cJSON_GetObjectItem(properties,"csid")->valueint;
-    std::string direct_call_set = cJSON_GetObjectItem(properties,"direct_call_set")->valuestring;
-    std::string indirect_call_set = cJSON_GetObjectItem(properties, "indirect_call_set")->valuestring;
-    int kind = cJSON_GetObjectItem(properties, "kind")->valueint;
+    int src_id = data->getInt(DB_FIELD("src"));
+    int dst_id = data->getInt(DB_FIELD("dst"));
+    int csid = properties->getInt(DB_FIELD("csid"));
+    std::string direct_call_set = properties->getString(DB_FIELD("direct_call_set"));
+    std::string indirect_call_set = properties->getString(DB_FIELD("indirect_call_set"));
+    int kind = properties->getInt(DB_FIELD("kind"));
 
     CallGraphNode* srcNode = callGraph->getGNode(src_id);
     CallGraphNode* dstNode = callGraph->getGNode(dst_id);
@@ -4257,17 +5883,14 @@ CallGraphEdge* GraphDBClient::parseCallGraphEdgeFromDB(const cJSON* edge, SVFIR*
         direct_call_set_ids = parseElements2Container<Set<int>>(direct_call_set);
         for (int directCallId : direct_call_set_ids)
         {
-            CallICFGNode* node = SVFUtil::dyn_cast<CallICFGNode>(pag->getICFG()->getGNode(directCallId));
-            const FunObjVar* callee = node->getCalledFunction();
-            std::pair<const CallICFGNode*, const FunObjVar*> newCS(std::make_pair(node, callee));
-            CallGraph::CallSiteToIdMap::const_iterator it = callGraph->csToIdMap.find(newCS);
-            if (it == callGraph->csToIdMap.end())
+            // -db-entry: the call site is added once its function is loaded
+            if (DBLazyLoad() && !pag->getICFG()->hasGNode(directCallId))
             {
-                callGraph->addCallSite(node, callee, cgEdge->getCallSiteID(), newCS);
-                callGraph->totalCallSiteNum++;
+                getLoadSession().pendingCallSites[directCallId].push_back(std::make_pair(cgEdge, true));
+                continue;
             }
-            cgEdge->addDirectCallSite(node);
-            callGraph->callinstToCallGraphEdgesMap[node].insert(cgEdge);
+            CallICFGNode* node = SVFUtil::dyn_cast<CallICFGNode>(pag->getICFG()->getGNode(directCallId));
+            addCallSite2CallGraphEdge(node, cgEdge, callGraph, true);
         }
     }
 
@@ -4277,24 +5900,207 @@ CallGraphEdge* GraphDBClient::parseCallGraphEdgeFromDB(const cJSON* edge, SVFIR*
         indirect_call_set_ids = parseElements2Container<Set<int>>(indirect_call_set);
         for (int indirectCallId : indirect_call_set_ids)
         {
-            CallICFGNode* node = SVFUtil::dyn_cast<CallICFGNode>(pag->getICFG()->getGNode(indirectCallId));
-            callGraph->numOfResolvedIndCallEdge++;
-            const FunObjVar* callee = node->getCalledFunction();
-            std::pair<const CallICFGNode*, const FunObjVar*> newCS(std::make_pair(node, callee));
-            CallGraph::CallSiteToIdMap::const_iterator it = callGraph->csToIdMap.find(newCS);
-            if (it == callGraph->csToIdMap.end())
+            if (DBLazyLoad() && !pag->getICFG()->hasGNode(indirectCallId))
             {
-                callGraph->addCallSite(node, callee, cgEdge->getCallSiteID(), newCS);
-                callGraph->totalCallSiteNum++;
+                getLoadSession().pendingCallSites[indirectCallId].push_back(std::make_pair(cgEdge, false));
+                continue;
             }
-            cgEdge->addInDirectCallSite(node);
-            callGraph->callinstToCallGraphEdgesMap[node].insert(cgEdge);
+            CallICFGNode* node = SVFUtil::dyn_cast<CallICFGNode>(pag->getICFG()->getGNode(indirectCallId));
+            addCallSite2CallGraphEdge(node, cgEdge, callGraph, false);
         }
     }
 
     return cgEdge;
 }
 
+void GraphDBClient::addCallSite2CallGraphEdge(CallICFGNode* node, CallGraphEdge* cgEdge, CallGraph* callGraph, bool isDirect)
+{
+    if (!isDirect)
+    {
+        callGraph->numOfResolvedIndCallEdge++;
+    }
+    const FunObjVar* callee = node->getCalledFunction();
+    std::pair<const CallICFGNode*, const FunObjVar*> newCS(std::make_pair(node, callee));
+    CallGraph::CallSiteToIdMap::const_iterator it = callGraph->csToIdMap.find(newCS);
+    if (it == callGraph->csToIdMap.end())
+    {
+        callGraph->addCallSite(node, callee, cgEdge->getCallSiteID(), newCS);
+        callGraph->totalCallSiteNum++;
+    }
+    if (isDirect)
+    {
+        cgEdge->addDirectCallSite(node);
+    }
+    else
+    {
+        cgEdge->addInDirectCallSite(node);
+    }
+    callGraph->callinstToCallGraphEdgesMap[node].insert(cgEdge);
+}
+
+void GraphDBClient::updateCallGraphCallSites(SVFIR* pag)
+{
+    ICFG* icfg = pag->getICFG();
+    for (auto it = getLoadSession().pendingCallSites.begin(); it != getLoadSession().pendingCallSites.end();)
+    {
+        if (!icfg->hasGNode(it->first))
+        {
+            ++it;
+            continue;
+        }
+        CallICFGNode* node = SVFUtil::dyn_cast<CallICFGNode>(icfg->getGNode(it->first));
+        if (nullptr == node)
+        {
+            SVFUtil::outs() << "Warning: [updateCallGraphCallSites] No matching CallICFGNode found for id: " << it->first << "\n";
+        }
+        else
+        {
+            for (auto& [cgEdge, isDirect] : it->second)
+            {
+                addCallSite2CallGraphEdge(node, cgEdge, pag->getCallGraph(), isDirect);
+            }
+        }
+        it = getLoadSession().pendingCallSites.erase(it);
+    }
+}
+
+bool GraphDBClient::isFunctionLoaded(NodeID funObjVarId) const
+{
+    return getLoadSession().loadedFunObjVarIds.find(funObjVarId) != getLoadSession().loadedFunObjVarIds.end();
+}
+
+Set<NodeID> GraphDBClient::getReachableFunctions(const CallGraph* callGraph, const std::string& entryNames)
+{
+    Set<std::string> entries;
+    std::istringstream ss(entryNames);
+    std::string name;
+    while (std::getline(ss, name, ','))
+    {
+        if (!name.empty())
+        {
+            entries.insert(name);
+        }
+    }
+
+    Set<NodeID> reachable;
+    std::vector<const CallGraphNode*> worklist;
+    for (const auto& item : *callGraph)
+    {
+        const CallGraphNode* cgNode = item.second;
+        if (entries.erase(cgNode->getName()) > 0 && reachable.insert(cgNode->getFunction()->getId()).second)
+        {
+            worklist.push_back(cgNode);
+        }
+    }
+    for (const std::string& missing : entries)
+    {
+        SVFUtil::outs() << "Warning: [getReachableFunctions] No matching CallGraphNode found for entry: " << missing << "\n";
+    }
+
+    // every stored call edge is followed: the direct calls, and the indirect
+    // ones resolved by an earlier run with -write2db-ind-calls. Other targets
+    // of indirect calls are not known before pointer analysis, list them in
+    // -db-entry to load them
+    while (!worklist.empty())
+    {
+        const CallGraphNode* cgNode = worklist.back();
+        worklist.pop_back();
+        for (const CallGraphEdge* edge : cgNode->getOutEdges())
+        {
+            const CallGraphNode* callee = edge->getDstNode();
+            if (reachable.insert(callee->getFunction()->getId()).second)
+            {
+                worklist.push_back(callee);
+            }
+        }
+    }
+    return reachable;
+}
+
+void GraphDBClient::loadFunctionsFromDB(lgraph::RpcClient* connection, const Set<NodeID>& funObjVarIds, SVFIR* pag)
+{
+    std::vector<FunObjVar*> funs;
+    std::string idList = "";
+    for (NodeID id : funObjVarIds)
+    {
+        if (isFunctionLoaded(id))
+        {
+            continue;
+        }
+        FunObjVar* funObjVar = getLoadSession().id2funObjVarsMap.find(id);
+        if (nullptr == funObjVar)
+        {
+            SVFUtil::outs() << "Warning: [loadFunctionsFromDB] No matching FunObjVar found for id: " << id << "\n";
+            continue;
+        }
+        getLoadSession().loadedFunObjVarIds.insert(id);
+        funs.push_back(funObjVar);
+        idList += (idList.empty() ? "" : ", ") + std::to_string(id);
+    }
+    if (funs.empty())
+    {
+        return;
+    }
+    SVFUtil::outs() << "Loading " << funs.size() << " functions from DB....\n";
+    const std::string inFuns = " IN [" + idList + "]";
+    ICFG* icfg = pag->getICFG();
+
+    // the blocks first, the ICFG nodes refer to them
+    Map<SVFBasicBlock*, std::pair<std::string, std::string>> bb2EdgeIdsMap;
+    {
+        DBPageReader reader(connection, "BasicBlockGraph",
+                            "MATCH (node:SVFBasicBlock) WHERE node.fun_obj_var_id" + inFuns + " WITH node",
+                            "node", {"id(node)"});
+        readBasicBlockNodesFromDB(reader, bb2EdgeIdsMap);
+    }
+    for (FunObjVar* fun : funs)
+    {
+        readBasicBlockEdgesFromDB(fun, bb2EdgeIdsMap);
+    }
+
+    for (const std::string& nodeType : funICFGNodeTypes)
+    {
+        DBPageReader reader(connection, "ICFG",
+                            "MATCH (node:" + nodeType + ") WHERE node.fun_obj_var_id" + inFuns + " WITH node",
+                            "node", {"node.id"});
+        readICFGNodesFromDB(reader, nodeType, icfg, pag);
+    }
+    // the edges leaving these functions, then those entering them from
+    // elsewhere; those whose other end is not loaded yet are skipped by
+    // readICFGEdgesFromDB() and read again with that end
+    for (const std::string& edgeType : icfgEdgeTypes)
+    {
+        for (const std::string& srcType : icfgEdgeSrcTypes.at(edgeType))
+        {
+            if (srcType == "GlobalICFGNode")
+                continue;
+            DBPageReader reader(connection, "ICFG",
+                                "MATCH (n:" + srcType + ") WHERE n.fun_obj_var_id" + inFuns + " WITH n", "n", {"n.id"},
+                                "OPTIONAL MATCH (n)-[edge:" + edgeType + "]->(m)", "edge");
+            readICFGEdgesFromDB(reader, edgeType, icfg, pag);
+        }
+    }
+    for (const std::array<std::string, 3>& edgeTypes : interFunICFGEdgeTypes)
+    {
+        // the GlobalICFGNode is in no function
+        const std::string fromOtherFuns =
+            edgeTypes[1] == "GlobalICFGNode" ? "" : " WHERE NOT m.fun_obj_var_id" + inFuns;
+        DBPageReader reader(connection, "ICFG",
+                            "MATCH (n:" + edgeTypes[2] + ") WHERE n.fun_obj_var_id" + inFuns + " WITH n", "n", {"n.id"},
+                            "OPTIONAL MATCH (m:" + edgeTypes[1] + ")-[edge:" + edgeTypes[0] + "]->(n)" + fromOtherFuns,
+                            "edge");
+        readICFGEdgesFromDB(reader, edgeTypes[0], icfg, pag);
+    }
+    updateBasicBlockNodes(icfg);
+    updateCallGraphCallSites(pag);
+
+    updatePAGNodesFromDB(pag);
+    loadSVFStmtsOfICFGNodesFromDB(connection, "PAG", pag);
+    updateCallPEs4CallCFGEdge();
+    updateRetPE4RetCFGEdge();
+    parseSVFStmtsForICFGNodeFromDBResult(pag);
+}
+
 /// BasicBlockGraph insertions query statements
 const std::string GraphDBClient::bbEdge2DBString(const BasicBlockEdge* edge)
 {
@@ -4320,12 +6126,13 @@ const std::string GraphDBClient::bb2DBString(const SVFBasicBlock* bb)
 }
 
 /// CallGraph insertions query statements
-const std::string GraphDBClient::callGraphNode2DBString(const CallGraphNode* node)
+const std::string GraphDBClient::callGraphNode2DBString(const CallGraphNode* node, const std::string& contentHash)
 {
     const std::string queryStatement ="CREATE (n:CallGraphNode {id: " + std::to_string(node->getId()) +
                              ", fun_obj_var_id: " + std::to_string(node->getFunction()->getId()) + 
                              sourceLocToDBString(node) +
-                             ", fun_name:'" + node->getName()+ "'"
+                             ", fun_name:'" + node->getName()+ "'" +
+                             (contentHash.empty() ? "" : ", content_hash:'" + contentHash + "'") +
                              "})";
     return queryStatement;
 }
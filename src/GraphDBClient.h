@@ -8,10 +8,19 @@
 #include "SVFIR/SVFStatements.h"
 #include "SVFIR/SVFType.h"
 #include "Util/SVFUtil.h"
-#include "Util/cJSON.h"
+#include "DBResult.h"
+#include "DBIdList.h"
+#include "DBLoadSession.h"
+#include "DBWritePlan.h"
 #include "lgraph/lgraph_rpc_client.h"
+#include "DBOptions.h"
+#include "DBBatchWriter.h"
 #include <errno.h>
+#include <functional>
+#include <mutex>
 #include <stdio.h>
+#include <thread>
+#include <tuple>
 
 namespace SVF
 {
@@ -31,15 +40,150 @@ class BasicBlockGraph;
 class CHGraph;
 class CHEdge;
 class CHNode;
+class DBConnectionPool;
+class DBPageReader;
+class DBSnapshot;
+class BVDataPTAImpl;
+class VFGNode;
+class MHP;
+class LockAnalysis;
+
+/// whether Container is a hash container, whose order changes from run to run
+template <typename Container, typename = void>
+struct IsHashContainer : std::false_type {};
+template <typename Container>
+struct IsHashContainer<Container, std::void_t<typename Container::hasher>> : std::true_type {};
+
+/// The identity of the PAG nodes across builds, the dense ids moving whenever
+/// a node is added or removed before them (GraphDBClient::getPAGNodeKeys()).
+/// A node of one function is keyed "<function>#<ordinal>", in id order among
+/// the nodes of the function; any other by its kind, name, type and value, as
+/// "@<hash>#<ordinal>" among the nodes alike; a field object by its base
+/// object and offset, as "<base key>+<offset>".
+struct DBPAGNodeKeys
+{
+    /// the nodes of each function, in the order of their ordinals
+    Map<std::string, std::vector<NodeID>> funNodes;
+    /// the nodes of no function but the field objects, by key
+    Map<std::string, NodeID> globalNodes;
+    Map<NodeID, std::string> keys;
+
+    inline const std::string& getKey(NodeID id) const
+    {
+        static const std::string none;
+        auto it = keys.find(id);
+        return it != keys.end() ? it->second : none;
+    }
+};
+
+/// The rows of the PTA graph written by GraphDBClient::insertPTA2db(), with the
+/// ids of the run which wrote them
+struct DBPTAResult
+{
+    int ptaTy = -1;
+    /// stamp of the PAG graph the points-to sets were computed on
+    s64_t pagStamp = -1;
+    /// the hashes of hashPAGContent() of that PAG, by function and for the rest
+    std::vector<std::pair<std::string, std::string>> funHashes;
+    std::string globalHash;
+    /// the stmts of every function as kind, src, dst triples, an indirect call
+    /// site being kind -1, the function pointer and the value returned (else the pointer)
+    Map<std::string, std::vector<s64_t>> funStmts;
+    std::vector<NodeID> fieldInsensitiveObjs;
+    /// the field objects created while solving: id, base object and offset
+    std::vector<std::tuple<NodeID, NodeID, s64_t>> gepObjs;
+    /// every node with a non-empty points-to set and the objects it points to
+    std::vector<std::pair<NodeID, std::vector<NodeID>>> pts;
+    /// the keys of the nodes of that run (DBPAGNodeKeys): the nodes of each
+    /// function in the order of their ordinals, and the other nodes with their keys
+    Map<std::string, std::vector<NodeID>> funNodes;
+    std::vector<std::pair<NodeID, std::string>> globalNodes;
+};
+
+/// The rows of the ThreadAnalysis graph written by
+/// GraphDBClient::insertThreadAnalysis2db(). The contexts are folded: two
+/// statements s and t may happen in parallel if some thread of s is among the
+/// interleaving threads t has in that thread, and the other way round.
+struct DBThreadAnalysisResult
+{
+    struct Thread
+    {
+        NodeID id;          ///< the TCT node
+        int forkSiteId;     ///< the ICFG node of the fork, -1 for the main thread
+        int parentId;       ///< the thread forking it, -1 for the main thread
+        bool multiforked;
+        std::vector<NodeID> cxt;    ///< the call string of the fork
+    };
+    struct Site
+    {
+        NodeID id;          ///< the ICFG node of the fork/join
+        bool isFork;
+        std::vector<NodeID> peIds;  ///< its TDForkPE/TDJoinPE stmts
+    };
+    struct Stmt
+    {
+        NodeID id;          ///< the ICFG node
+        std::vector<NodeID> threadIds;
+        std::vector<std::vector<NodeID>> interleavingThreadIds;   ///< one list per thread of threadIds
+        std::vector<NodeID> lockSiteIds;    ///< the ICFG nodes of the locks held in every context
+    };
+    s64_t pagStamp = -1;
+    std::vector<Thread> threads;
+    std::vector<Site> sites;
+    std::vector<Stmt> stmts;
+};
+
+/// A bug found by a SABER checker, as kept in the BugReport graph. The ids
+/// are those of the PAG, ICFG and SVFG of the run which found it.
+struct DBBugReport
+{
+    NodeID id;                  ///< its index among the reports of the run
+    std::string kind;           ///< GenericBug::BugType, e.g. "NEVERFREE"
+    std::string fingerprint;    ///< hash of the kind and the source/sink locations, kept across builds
+    int sourceICFGNodeId;
+    int sourcePAGNodeId;
+    std::string sourceLoc;
+    std::vector<NodeID> sinkICFGNodeIds;
+    std::vector<NodeID> sinkPAGNodeIds;
+    std::vector<NodeID> pathSVFGNodeIds;    ///< the value-flow witness, source first
+    std::vector<NodeID> pathICFGNodeIds;    ///< the ICFG nodes along it
+};
+
+/// The reports of one run kept in the BugReport graph, which every run
+/// with -write2db appends its reports to
+struct DBBugReportResult
+{
+    s64_t runId = -1;           ///< the time the run wrote them, in ms
+    s64_t pagStamp = -1;        ///< the PAG and ICFG graphs the ids are of
+    s64_t icfgStamp = -1;
+    std::vector<DBBugReport> reports;
+};
+
 class GraphDBClient
 {
 private:
     lgraph::RpcClient* connection;
-
-    GraphDBClient()
+    /// connections of the writer threads (-db-threads), created on first use
+    DBConnectionPool* connectionPool;
+    std::mutex connectionPoolMtx;
+    /// results of the read queries kept across runs (-db-snapshot)
+    DBSnapshot* snapshot;
+    /// the load state of the threads without a DBLoadSession::Scope of their own
+    DBLoadSession* ownLoadSession;
+    /// the rows to write under -write2db-incremental, nullptr to write every row
+    DBWritePlan* writePlan;
+    /// stamps of the graphs written by this process, also known offline
+    Map<std::string, s64_t> writtenStamps;
+    std::mutex writtenStampsMtx;
+
+    GraphDBClient() : connection(nullptr), connectionPool(nullptr), snapshot(nullptr),
+        ownLoadSession(new DBLoadSession()), writePlan(nullptr)
     {
-        const char* url = "127.0.0.1:9090";
-        connection = new lgraph::RpcClient(url, "admin", "73@TuGraph");
+        // offline export (-write2db-offline) does not need a running server
+        if (Write2DBOfflineDir().empty())
+        {
+            connection = createConnection();
+        }
     }
 
     ~GraphDBClient()
@@ -48,6 +192,18 @@ private:
         {
             connection = nullptr;
         }
+        // like connection, the pool is kept until the process exits
+        connectionPool = nullptr;
+        delete ownLoadSession;
+        ownLoadSession = nullptr;
+        delete writePlan;
+        writePlan = nullptr;
+    }
+
+    static lgraph::RpcClient* createConnection()
+    {
+        const char* url = "127.0.0.1:9090";
+        return new lgraph::RpcClient(url, "admin", "73@TuGraph");
     }
 
 public:
@@ -64,11 +220,96 @@ public:
     {
         return connection;
     }
+    /// the DBThreads() connections shared by the parallel writers
+    DBConnectionPool* getConnectionPool();
 
     bool loadSchema(lgraph::RpcClient* connection, const std::string& filepath,
                     const std::string& dbname);
     bool createSubGraph(lgraph::RpcClient* connection,
                         const std::string& graphname);
+    /// whether graphs are written as TuGraph import files instead of to the server
+    inline bool isOfflineMode() const
+    {
+        return !Write2DBOfflineDir().empty();
+    }
+    /// (re)create graphname with the given schema files and return the writer
+    /// for its rows, an offline import writer under -write2db-offline; the graph
+    /// gets a new DBVersion stamp and any -db-snapshot is invalidated. A graph
+    /// patched by -write2db-incremental is kept, see patchSubGraph()
+    DBBatchWriter* createGraphWriter(const std::string& graphname,
+                                     const std::vector<std::string>& schemaFiles);
+    /// -write2db-incremental: compare the content hashes of the program with those
+    /// stored by the previous write (see DBWritePlan), so that the insert*2db()
+    /// following only replace the rows of the functions which changed, and only
+    /// rewrite a whole graph if its rows belonging to no function changed
+    void planIncrementalWrite(SVFIR* pag, const CHGraph* chg);
+    /// delete from graphname the rows of the functions the plan rewrites
+    bool patchSubGraph(lgraph::RpcClient* connection, const std::string& graphname);
+    /// whether graphname is patched rather than written again as a whole
+    inline bool isGraphPatched(const std::string& graphname) const
+    {
+        return nullptr != writePlan && writePlan->isPatched(graphname);
+    }
+    /// whether anything is to be written into graphname
+    inline bool needsWrite(const std::string& graphname) const
+    {
+        return nullptr == writePlan || writePlan->needsWrite(graphname);
+    }
+    /// whether the rows of fun (nullptr for rows of no function) are written into graphname
+    inline bool isRowWritten(const std::string& graphname, const FunObjVar* fun) const
+    {
+        return !isGraphPatched(graphname) || (nullptr != fun && writePlan->isRewritten(fun->getName()));
+    }
+    /// stamp of the DBVersion vertex of graphname, -1 if it has none
+    s64_t readVersionStamp(lgraph::RpcClient* connection, const std::string& graphname);
+    /// content_hash of the DBVersion vertex of graphname, "" if it has none
+    std::string readContentHash(lgraph::RpcClient* connection, const std::string& graphname);
+    /// the stamp graphname was written with by this process, else the one in DB
+    s64_t getGraphStamp(const std::string& graphname);
+    /// under -db-snapshot, answer the following reads from the snapshot file if
+    /// it matches the graphs in the DB, else record them; closeSnapshot() saves
+    void openSnapshot(lgraph::RpcClient* connection);
+    void closeSnapshot();
+    /// serialize items to insert statements with DBThreads() producer threads and
+    /// hand them to writer in their original order, a chunk at a time
+    template <typename T, typename ToStmt>
+    void addStmts2Writer(const std::vector<T>& items, ToStmt toStmt, DBBatchWriter* writer, bool isEdge)
+    {
+        const u32_t numOfThreads = DBThreads() > 0 ? DBThreads() : 1;
+        // large enough that starting the producers is cheap next to the work,
+        // small enough that the chunk's statements need not all be kept alive
+        const size_t chunkSize = static_cast<size_t>(numOfThreads) * std::max(DBBatchSize(), 1024u);
+        std::vector<std::string> stmts;
+        for (size_t begin = 0; begin < items.size(); begin += chunkSize)
+        {
+            const size_t end = std::min(items.size(), begin + chunkSize);
+            stmts.assign(end - begin, "");
+            auto serialize = [&](u32_t tid)
+            {
+                for (size_t i = begin + tid; i < end; i += numOfThreads)
+                {
+                    stmts[i - begin] = toStmt(items[i]);
+                }
+            };
+            std::vector<std::thread> producers;
+            for (u32_t tid = 1; tid < numOfThreads && begin + tid < end; ++tid)
+            {
+                producers.emplace_back(serialize, tid);
+            }
+            serialize(0);
+            for (std::thread& producer : producers)
+            {
+                producer.join();
+            }
+            for (const std::string& stmt : stmts)
+            {
+                if (isEdge)
+                    writer->addEdgeStmt(stmt);
+                else
+                    writer->addNodeStmt(stmt);
+            }
+        }
+    }
     bool addCallGraphNode2db(lgraph::RpcClient* connection,
                              const CallGraphNode* node,
                              const std::string& dbname);
@@ -85,11 +326,68 @@ public:
 
     void insertICFG2db(const ICFG* icfg);
     void insertCallGraph2db(const CallGraph* callGraph);
+    /// replace the edges of the CallGraph graph with those of callGraph with indirect
+    /// calls, i.e. those resolved by a pointer analysis, its edges being matched on
+    /// their ends, kind and csid
+    void updateIndCallEdges2db(const CallGraph* callGraph);
     void insertPAG2db(const SVFIR* pag);
-    void insertBasicBlockGraph2db(const BasicBlockGraph* bbGraph);
+    void insertBasicBlockGraph2db(const BasicBlockGraph* bbGraph, DBBatchWriter* writer);
+    /// the keys of the PAG nodes, which name them across builds
+    void getPAGNodeKeys(SVFIR* pag, DBPAGNodeKeys& keys);
+    /// the content hash of the constraints of every function, i.e. of the PAG
+    /// stmts of its ICFG nodes and the PAG nodes they connect or it owns, the other
+    /// stmts and nodes being summed into the hash of graph "PAG"; the rows hashed
+    /// name the nodes by their keys, so that the hashes hold across id shifts
+    void hashPAGContent(SVFIR* pag, const DBPAGNodeKeys& keys, DBWritePlan& hashes);
+    /// write the points-to sets of pta into the PTA graph, with the field objects the
+    /// solver added to pag and the objects it made field-insensitive
+    void insertPTA2db(BVDataPTAImpl* pta, SVFIR* pag);
+    /// read the PTA graph, false if there is none
+    bool readPTAFromDB(lgraph::RpcClient* connection, const std::string& dbname, DBPTAResult& result);
+    /// store the file svfgFile SVF wrote a SABER checker's value-flow graph to under
+    /// -write-svfg, memory SSA included, in the SVFG graph; a file cache kept for the
+    /// PAG it was built on, SVF alone reading the graph back
+    void insertSVFG2db(const std::string& svfgFile);
+    /// str escaped to go between the single quotes of a cypher string literal
+    static std::string escapeString(const std::string& str);
+    /// the value a value-flow node defines, nullptr for the memory region nodes
+    static const SVFVar* getValueOfSVFGNode(const VFGNode* node);
+    /// write the -write-svfg file stored in the SVFG graph to filename, for SVF
+    /// to read under -read-svfg; false if there is none or it was built on another PAG
+    bool readSVFGFileFromDB(lgraph::RpcClient* connection, const std::string& dbname, const std::string& filename);
+    /// write the threads, fork/join sites, may-happen-in-parallel relation and
+    /// locks held found by MTA into the ThreadAnalysis graph
+    void insertThreadAnalysis2db(MHP* mhp, LockAnalysis* lsa, SVFIR* pag);
+    /// read the ThreadAnalysis graph, false if there is none or it was built on another PAG
+    bool readThreadAnalysisFromDB(lgraph::RpcClient* connection, const std::string& dbname,
+                                  DBThreadAnalysisResult& result);
+    /// append the bugs reported by a SABER checker to the BugReport graph as a
+    /// new run, the graph being created by the first one
+    void insertBugReports2db(const std::vector<DBBugReport>& reports);
+    std::string getBugReportInsertStmt(s64_t runId, const DBBugReport& report);
+    /// read the reports of run runId from the BugReport graph, of the latest
+    /// run if runId is -1; false if there is none
+    bool readBugReportsFromDB(lgraph::RpcClient* connection, const std::string& dbname, s64_t runId,
+                              DBBugReportResult& result);
+    /// the file of the stored procedure name, in -db-procedure-dir or else in the
+    /// procedures directory next to the bin directory of the running tool
+    static std::string getProcedureFile(const std::string& name);
+    /// load the stored procedures into the graphs they query (svf_icfg_reach
+    /// into ICFG, svf_points_to into PAG), replacing older ones
+    void loadProcedures2db();
+    /// load the stored procedure name into graph, false if its file is missing or the load failed
+    bool loadProcedure(lgraph::RpcClient* connection, const std::string& name, const std::string& graph,
+                       bool readOnly);
+    /// call the stored procedure name of graph with the JSON request param,
+    /// result being its JSON response; false if the call failed
+    bool callProcedure(const std::string& graph, const std::string& name, const std::string& param,
+                       std::string& result);
+    /// answer -db-query-pts and -db-query-reach with the stored procedures
+    void queryProcedures();
     void insertSVFTypeNodeSet2db(const Set<const SVFType*>* types,
                                  const Set<const StInfo*>* stInfos,
                                  std::string& dbname);
+    std::string getSVFTypeInsertStmt(const SVFType* ty);
 
     /// @brief parse the CHG and generate the insert statements for CHG nodes and edges
     /// @param chg  
@@ -97,6 +395,7 @@ public:
     void insertCHNode2db(lgraph::RpcClient* connection, const CHNode* node, const std::string& dbname);
     void insertCHEdge2db(lgraph::RpcClient* connection, const CHEdge* edge, const std::string& dbname);
     void updateCHNodes2ICFGNode(lgraph::RpcClient* connection, const std::string& dbname, const int icfgId, const std::string& dataStr, const std::string& fieldName);
+    std::string getCHNodes2ICFGNodeUpdateStmt(const int icfgId, const std::string& dataStr, const std::string& fieldName);
     std::string getCHNodeInsertStmt(const CHNode* node);
     std::string getCHEdgeInsertStmt(const CHEdge* edge);
 
@@ -114,8 +413,10 @@ public:
 
     /// parse ICFGNodes & generate the insert statement for ICFGNodes
     std::string getICFGNodeKindString(const ICFGNode* node);
+    std::string getICFGNodeInsertStmt(const ICFGNode* node);
+    std::string getICFGEdgeInsertStmt(const ICFGEdge* edge);
 
-    cJSON* queryFromDB(lgraph::RpcClient* connection, const std::string& dbname, std::string queryStatement);
+    DBResult* queryFromDB(lgraph::RpcClient* connection, const std::string& dbname, std::string queryStatement);
     /// read SVFType from DB
     void readSVFTypesFromDB(lgraph::RpcClient* connection,
                             const std::string& dbname, SVFIR* pag);
@@ -124,57 +425,111 @@ public:
 
     /// read BasicBlockGraph from DB
     void readBasicBlockGraphFromDB(lgraph::RpcClient* connection, const std::string& dbname);
-    void readBasicBlockNodesFromDB(lgraph::RpcClient* connection, const std::string& dbname, FunObjVar* funObjVar);
-    void readBasicBlockEdgesFromDB(lgraph::RpcClient* connection, const std::string& dbname, FunObjVar* funObjVar);
+    /// create the blocks of every function, keeping their pred_bb_ids/sscc_bb_ids
+    void readBasicBlockNodesFromDB(DBPageReader& reader,
+                                   Map<SVFBasicBlock*, std::pair<std::string, std::string>>& bb2EdgeIdsMap);
+    void readBasicBlockEdgesFromDB(FunObjVar* funObjVar,
+                                   const Map<SVFBasicBlock*, std::pair<std::string, std::string>>& bb2EdgeIdsMap);
     void updateBasicBlockNodes(ICFG* icfg);
 
     /// read ICFGNodes & ICFGEdge from DB
     ICFG* buildICFGFromDB(lgraph::RpcClient* connection, const std::string& dbname, SVFIR* pag);
     /// ICFGNodes
     void readICFGNodesFromDB(lgraph::RpcClient* connection, const std::string& dbname, std::string nodeType, ICFG* icfg, SVFIR* pag);
-    ICFGNode* parseGlobalICFGNodeFromDBResult(const cJSON* node, SVFIR* pag);
-    ICFGNode* parseFunEntryICFGNodeFromDBResult(const cJSON* node, SVFIR* pag);
-    ICFGNode* parseFunExitICFGNodeFromDBResult(const cJSON* node, SVFIR* pag);
-    ICFGNode* parseRetICFGNodeFromDBResult(const cJSON* node, SVFIR* pag);
-    ICFGNode* parseIntraICFGNodeFromDBResult(const cJSON* node, SVFIR* pag);
-    ICFGNode* parseCallICFGNodeFromDBResult(const cJSON* node, SVFIR* pag);
+    void readICFGNodesFromDB(DBPageReader& reader, std::string nodeType, ICFG* icfg, SVFIR* pag);
+    ICFGNode* parseGlobalICFGNodeFromDBResult(const DBValue* node, SVFIR* pag);
+    ICFGNode* parseFunEntryICFGNodeFromDBResult(const DBValue* node, SVFIR* pag);
+    ICFGNode* parseFunExitICFGNodeFromDBResult(const DBValue* node, SVFIR* pag);
+    ICFGNode* parseRetICFGNodeFromDBResult(const DBValue* node, SVFIR* pag);
+    ICFGNode* parseIntraICFGNodeFromDBResult(const DBValue* node, SVFIR* pag);
+    ICFGNode* parseCallICFGNodeFromDBResult(const DBValue* node, SVFIR* pag);
     void parseSVFStmtsForICFGNodeFromDBResult(SVFIR* pag);
     void updateRetPE4RetCFGEdge();
     void updateCallPEs4CallCFGEdge();
     
     /// ICFGEdges
     void readICFGEdgesFromDB(lgraph::RpcClient* connection, const std::string& dbname, std::string edgeType, ICFG* icfg, SVFIR* pag);
-    ICFGEdge* parseIntraCFGEdgeFromDBResult(const cJSON* edge, SVFIR* pag, ICFG* icfg);
-    ICFGEdge* parseCallCFGEdgeFromDBResult(const cJSON* edge, SVFIR* pag, ICFG* icfg);
-    ICFGEdge* parseRetCFGEdgeFromDBResult(const cJSON* edge, SVFIR* pag, ICFG* icfg);
+    void readICFGEdgesFromDB(DBPageReader& reader, std::string edgeType, ICFG* icfg, SVFIR* pag);
+    ICFGEdge* parseIntraCFGEdgeFromDBResult(const DBValue* edge, SVFIR* pag, ICFG* icfg);
+    ICFGEdge* parseCallCFGEdgeFromDBResult(const DBValue* edge, SVFIR* pag, ICFG* icfg);
+    ICFGEdge* parseRetCFGEdgeFromDBResult(const DBValue* edge, SVFIR* pag, ICFG* icfg);
 
     // read CallGraph Nodes & CallGraphEdge from DB
     CallGraph* buildCallGraphFromDB(lgraph::RpcClient* connection, const std::string& dbname, SVFIR* pag);
-    CallGraphNode* parseCallGraphNodeFromDB(const cJSON* node);
-    CallGraphEdge* parseCallGraphEdgeFromDB(const cJSON* edge, SVFIR* pag, CallGraph* callGraph);
+    CallGraphNode* parseCallGraphNodeFromDB(const DBValue* node);
+    CallGraphEdge* parseCallGraphEdgeFromDB(const DBValue* edge, SVFIR* pag, CallGraph* callGraph);
     void readCallGraphNodesFromDB(lgraph::RpcClient* connection, const std::string& dbname, CallGraph* callGraph);
     void readCallGraphEdgesFromDB(lgraph::RpcClient* connection, const std::string& dbname, SVFIR* pag, CallGraph* callGraph);
+    void addCallSite2CallGraphEdge(CallICFGNode* node, CallGraphEdge* cgEdge, CallGraph* callGraph, bool isDirect);
+    /// -db-entry: add the call sites of the CallGraph edges whose CallICFGNode has been read since
+    void updateCallGraphCallSites(SVFIR* pag);
+
+    /// -db-entry: read the BasicBlockGraph, ICFG nodes and edges and the stmts of
+    /// the given functions (by fun_obj_var_id) which are not loaded yet, then
+    /// resolve the PAG nodes, CFG edges and call sites waiting for them
+    void loadFunctionsFromDB(lgraph::RpcClient* connection, const Set<NodeID>& funObjVarIds, SVFIR* pag);
+    inline void loadFunctionFromDB(lgraph::RpcClient* connection, NodeID funObjVarId, SVFIR* pag)
+    {
+        loadFunctionsFromDB(connection, {funObjVarId}, pag);
+    }
+    bool isFunctionLoaded(NodeID funObjVarId) const;
+    /// fun_obj_var_ids of the functions reachable in callGraph from the comma
+    /// separated function names (-db-entry), the entries included
+    Set<NodeID> getReachableFunctions(const CallGraph* callGraph, const std::string& entryNames);
 
     /// read CHG from DB
     CHGraph* buildCHGraphFromDB(lgraph::RpcClient* connection, const std::string& dbname, SVFIR* pag);
     void readCHNodesFromDB(lgraph::RpcClient* connection, const std::string& dbname, CHGraph* chg, SVFIR* pag);
     void readCHEdgesFromDB(lgraph::RpcClient* connection, const std::string& dbname, CHGraph* chg);
-    void parseCHNodeFromDB(const cJSON* node, CHGraph* chg, SVFIR* pag);
+    void parseCHNodeFromDB(const DBValue* node, CHGraph* chg, SVFIR* pag);
     void createCHNode(CHNode* chNode, CHGraph* chg);
     void updateCallNode2ClassesMap(const ICFGNode* icfgNode, Set<int> chNodeIds, CHGraph* chg);
     void updateCallNode2CHAVtblsMap(const ICFGNode* icfgNode, Set<int> VTableSetIds, SVFIR* pag);
 
+    /// number of vertices (or edges) of the labels in dbname, to size the id tables of the loader
+    u32_t readRowCountFromDB(lgraph::RpcClient* connection, const std::string& dbname,
+                             const std::vector<std::string>& labels, bool isEdge);
+    /// the state of the read in progress on the calling thread: the session of
+    /// its DBLoadSession::Scope if any, else the client's own one
+    inline DBLoadSession& getLoadSession() const
+    {
+        DBLoadSession* current = DBLoadSession::getCurrent();
+        return nullptr != current ? *current : *ownLoadSession;
+    }
+    /// free the state of the read once the SVFIR is complete; a -db-entry load
+    /// keeps it for the functions read later
+    void releaseDBLoadTables();
+
+    /// read every label with readLabel(reader, label), one label after another in the
+    /// given order; with -db-threads > 1 the pages of all labels are fetched and decoded
+    /// concurrently over the connection pool
+    void readLabelsFromDB(lgraph::RpcClient* connection, const std::string& dbname,
+                          const std::vector<std::string>& labels, const std::string& returnVar,
+                          const std::vector<std::string>& keyExprs,
+                          const std::function<std::string(const std::string&)>& getMatchStmt,
+                          const std::function<void(DBPageReader&, const std::string&)>& readLabel);
+
     /// read PAGNodes from DB
     void readPAGNodesFromDB(lgraph::RpcClient* connection, const std::string& dbname, std::string nodeType, SVFIR* pag);
+    void readPAGNodesFromDB(DBPageReader& reader, std::string nodeType, SVFIR* pag);
     void initialSVFPAGNodesFromDB(lgraph::RpcClient* connection, const std::string& dbname, SVFIR* pag);
-    void updateSVFPAGNodesAttributesFromDB(lgraph::RpcClient* connection, const std::string& dbname, std::string nodeType, SVFIR* pag);
-    void updatePAGNodesFromDB(lgraph::RpcClient* connection, const std::string& dbname, SVFIR* pag);
-    void updateSVFValVarAtrributes(cJSON* properties, ValVar* var, SVFIR* pag);
-    void updateGepValVarAttributes(cJSON* properties, GepValVar* var, SVFIR* pag);
-    void updateSVFBaseObjVarAtrributes(cJSON* properties, BaseObjVar* var, SVFIR* pag);
-    void updateFunObjVarAttributes(cJSON* properties, FunObjVar* var, SVFIR* pag);
+    /// keep the attributes of a node just read for updatePAGNodesFromDB()
+    void deferPAGNodeAttributes(const DBValue* properties, u32_t typeIdx, NodeID id);
+    /// resolve the attributes kept while reading the PAG nodes, once the ICFG,
+    /// CHG, CallGraph and BasicBlockGraph have been read
+    void updatePAGNodesFromDB(SVFIR* pag);
+    void updateSVFPAGNodeAttributes(const DeferredPAGNodeAttrs& attrs, SVFIR* pag);
+    /// whether the ICFG node and blocks the attributes refer to have been read
+    bool isPAGNodeAttrsResolvable(const DeferredPAGNodeAttrs& attrs, SVFIR* pag) const;
+    void updateSVFValVarAtrributes(const DeferredPAGNodeAttrs& attrs, ValVar* var, SVFIR* pag);
+    void updateGepValVarAttributes(const DeferredPAGNodeAttrs& attrs, GepValVar* var, SVFIR* pag);
+    void updateSVFBaseObjVarAtrributes(const DeferredPAGNodeAttrs& attrs, BaseObjVar* var, SVFIR* pag);
+    void updateFunObjVarAttributes(const DeferredPAGNodeAttrs& attrs, FunObjVar* var, SVFIR* pag);
     void loadSVFPAGEdgesFromDB(lgraph::RpcClient* connection, const std::string& dbname, SVFIR* pag);
+    /// -db-entry: read the stmts listed by the ICFG nodes read since the last call
+    void loadSVFStmtsOfICFGNodesFromDB(lgraph::RpcClient* connection, const std::string& dbname, SVFIR* pag);
     void readPAGEdgesFromDB(lgraph::RpcClient* connection, const std::string& dbname, std::string edgeType, SVFIR* pag);
+    void readPAGEdgesFromDB(DBPageReader& reader, std::string edgeType, SVFIR* pag);
     void parseAPIdxOperandPairsString(const std::string& ap_idx_operand_pairs, SVFIR* pag, AccessPath* ap);
     void parseOpVarString(std::string& op_var_node_ids, SVFIR* pag, std::vector<SVFVar*>& opVarNodes);
 
@@ -183,7 +538,8 @@ public:
     const std::string bbEdge2DBString(const BasicBlockEdge* edge);
 
     /// CallGraph toDBString()
-    const std::string callGraphNode2DBString(const CallGraphNode* node);
+    /// contentHash: the hash of the function stored with it by -write2db-incremental
+    const std::string callGraphNode2DBString(const CallGraphNode* node, const std::string& contentHash = "");
     const std::string callGraphEdge2DBString(const CallGraphEdge* edge);
 
 
@@ -344,17 +700,17 @@ public:
         return getValVarNodeFieldsStmt(var);
     }
 
-    std::string parseNodeSourceLocation(cJSON* node) const
+    std::string parseNodeSourceLocation(const DBValue* node) const
     {
-        cJSON* data = cJSON_GetObjectItem(node, "node");
+        const DBValue* data = node->get(DB_FIELD("node"));
         if (!data)
             return "";
 
-        cJSON* properties = cJSON_GetObjectItem(data, "properties");
+        const DBValue* properties = data->get(DB_FIELD("properties"));
         if (!properties)
             return "";
 
-        cJSON* sourceLocationNode = cJSON_GetObjectItem(properties, "source_loc");
+        const DBValue* sourceLocationNode = properties->get(DB_FIELD("source_loc"));
         std::string sourceLocation = "";
         if (nullptr != sourceLocationNode->valuestring)
         {
@@ -364,7 +720,7 @@ public:
         return sourceLocation.empty() ? "" : sourceLocation;
     }
 
-    ObjTypeInfo* parseObjTypeInfoFromDB(cJSON* properties, SVFIR* pag);
+    ObjTypeInfo* parseObjTypeInfoFromDB(const DBValue* properties, SVFIR* pag);
 
     std::string sourceLocToDBString(const SVFVar* var) const
     {
@@ -400,25 +756,48 @@ public:
     }
 
 
-    template <typename Container>
-    std::string extractNodesIds(const Container& nodes)
+    /// id lists are stored in the compact form of DBIdList; the ids of a hash
+    /// container are sorted, so that the same graph gives the same rows on every
+    /// run (see DBWritePlan)
+    template <typename Container, typename GetId>
+    static std::string encodeIds(const Container& items, GetId getId)
     {
-        if (nodes.empty())
+        if constexpr (IsHashContainer<Container>::value)
         {
-            return "";
+            std::vector<s64_t> ids;
+            ids.reserve(items.size());
+            for (const auto& item : items)
+            {
+                ids.push_back(static_cast<s64_t>(getId(item)));
+            }
+            std::sort(ids.begin(), ids.end());
+            return DBIdList::encode(ids.begin(), ids.end(), [](s64_t id) { return id; });
         }
-        std::ostringstream nodesIds;
-        auto it = nodes.begin();
-
-        nodesIds << (*it)->getId();
-        ++it;
+        else
+        {
+            return DBIdList::encode(items.begin(), items.end(), getId);
+        }
+    }
 
-        for (; it != nodes.end(); ++it)
+    /// the entries of a map keyed by nodes, ordered on the ids of the keys (null first)
+    template <typename MapType>
+    static std::vector<const typename MapType::value_type*> sortEntriesById(const MapType& map)
+    {
+        std::vector<const typename MapType::value_type*> entries;
+        entries.reserve(map.size());
+        for (const auto& entry : map)
         {
-            nodesIds << "," << (*it)->getId();
+            entries.push_back(&entry);
         }
+        auto keyId = [](const auto* entry) { return nullptr != entry->first ? static_cast<s64_t>(entry->first->getId()) : -1; };
+        std::sort(entries.begin(), entries.end(), [&keyId](const auto* a, const auto* b) { return keyId(a) < keyId(b); });
+        return entries;
+    }
 
-        return nodesIds.str();
+    template <typename Container>
+    std::string extractNodesIds(const Container& nodes)
+    {
+        return encodeIds(nodes, [](const auto& node) { return node->getId(); });
     }
 
     std::string extractFuncVectors2String(std::vector<std::vector<const FunObjVar*>> vec) {
@@ -453,53 +832,27 @@ public:
             }
             ++i; // skip '{'
 
-            std::vector<const FunObjVar*> vec;
-            std::string numStr;
-
-            while (i < str.size() && str[i] != '}')
+            size_t end = str.find('}', i);
+            if (end == std::string::npos)
             {
-                if (std::isdigit(str[i]))
-                {
-                    numStr += str[i];
-                }
-                else if (str[i] == ',')
-                {
-                    if (!numStr.empty())
-                    {
-                        const SVFVar* var = pag->getGNode(std::stoi(numStr));
-                        const FunObjVar* funObjVar = SVFUtil::dyn_cast<FunObjVar>(var);
-                        if (nullptr != funObjVar)
-                            vec.push_back(funObjVar);
-                        else 
-                            SVFUtil::outs()<<"Warning: No FunObjVar found for id " << numStr;
-                        numStr.clear();
-                    }
-                }
-                else if (!std::isspace(str[i]))
-                {
-                    SVFUtil::outs()<<
-                        "Unexpected character in number: " <<
-                        std::string(1, str[i]);
-                }
-                ++i;
+                SVFUtil::outs()<<"Expected '}' at position " <<
+                                         std::to_string(str.size());
+                end = str.size();
             }
 
-            if (!numStr.empty())
+            std::vector<const FunObjVar*> vec;
+            DBIdList::Reader reader(str.data() + i, str.data() + end);
+            s64_t id;
+            while (reader.next(id))
             {
-                const SVFVar* var = pag->getGNode(std::stoi(numStr));
+                const SVFVar* var = pag->getGNode(static_cast<NodeID>(id));
                 const FunObjVar* funObjVar = SVFUtil::dyn_cast<FunObjVar>(var);
                 if (nullptr != funObjVar)
                     vec.push_back(funObjVar);
                 else 
-                    SVFUtil::outs()<<"Warning: No FunObjVar found for id " << numStr;
-            }
-
-            if (i >= str.size() || str[i] != '}')
-            {
-                SVFUtil::outs()<<"Expected '}' at position " <<
-                                         std::to_string(i);
+                    SVFUtil::outs()<<"Warning: No FunObjVar found for id " << id;
             }
-            ++i; // skip '}'
+            i = end + 1; // skip '}'
 
             result.push_back(vec);
         }
@@ -510,81 +863,40 @@ public:
     template <typename Container>
     std::string extractEdgesIds(const Container& edges)
     {
-        if (edges.empty())
-        {
-            return "";
-        }
-        std::ostringstream edgesIds;
-        auto it = edges.begin();
-
-        edgesIds << (*it)->getEdgeID();
-        ++it;
-
-        for (; it != edges.end(); ++it)
-        {
-            edgesIds << "," << (*it)->getEdgeID();
-        }
-
-        return edgesIds.str();
+        return encodeIds(edges, [](const auto& edge) { return edge->getEdgeID(); });
     }
 
     template <typename Container>
     std::string extractIdxs(const Container& idxVec)
     {
-        if (idxVec.empty())
-        {
-            return "";
-        }
-        std::ostringstream idxVecStr;
-        auto it = idxVec.begin();
-    
-        idxVecStr << *it;
-        ++it;
-    
-        for (; it != idxVec.end(); ++it)
-        {
-            idxVecStr << "," << *it;
-        }
-    
-        return idxVecStr.str();
+        return encodeIds(idxVec, [](const auto& idx) { return idx; });
     }
 
     template <typename Container>
     Container parseElements2Container(std::string& str)
     {
-        str.erase(std::remove(str.begin(), str.end(), '\n'), str.end());
-        str.erase(std::remove(str.begin(), str.end(), '\r'), str.end());
         Container idxVec;
-        std::istringstream ss(str);
-        std::string token;
-
-        while (std::getline(ss, token, ','))
+        using ValueType = typename Container::value_type;
+        if constexpr (std::is_integral<ValueType>::value)
         {
-            if constexpr (std::is_same<typename Container::value_type,
-                                       int>::value)
+            // decoded in place, either form of DBIdList
+            DBIdList::Reader reader(str);
+            s64_t id;
+            while (reader.next(id))
             {
-                if constexpr (std::is_same<Container, std::vector<int>>::value ||
-                          std::is_same<Container, std::list<int>>::value)
-                    idxVec.push_back(std::stoi(token));
-                else
-                    idxVec.insert(std::stoi(token));
-            }
-            else if constexpr (std::is_same<typename Container::value_type,
-                                            uint32_t>::value)
-            {
-                if constexpr (std::is_same<Container, std::vector<uint32_t>>::value || 
-                    std::is_same<Container, std::list<uint32_t>>::value)
-                    idxVec.push_back(static_cast<uint32_t>(std::stoul(token)));
-                else
-                    idxVec.insert(static_cast<uint32_t>(std::stoul(token)));
+                idxVec.insert(idxVec.end(), static_cast<ValueType>(id));
             }
-            else
+        }
+        else
+        {
+            str.erase(std::remove(str.begin(), str.end(), '\n'), str.end());
+            str.erase(std::remove(str.begin(), str.end(), '\r'), str.end());
+            std::istringstream ss(str);
+            std::string token;
+
+            while (std::getline(ss, token, ','))
             {
-                if constexpr (std::is_same<Container, std::vector<float>>::value ||
-                          std::is_same<Container, std::list<float>>::value)
-                    idxVec.push_back(std::stof(token));
-                 else
-                    idxVec.insert(std::stof(token));
+                idxVec.insert(idxVec.end(), static_cast<ValueType>(std::stof(token)));
             }
         }
 
@@ -759,14 +1071,14 @@ public:
         }
         std::ostringstream mapStr;
 
-        for (auto it = labelMap->begin(); it != labelMap->end(); ++it)
+        for (const auto* entry : sortEntriesById(*labelMap))
         {
-            if (it != labelMap->begin())
+            if (mapStr.tellp() != std::streampos(0))
             {
                 mapStr << ",";
             }
-            mapStr << (it->first ? std::to_string(it->first->getId()) : "NULL")
-                   << ":" << std::to_string(it->second);
+            mapStr << (entry->first ? std::to_string(entry->first->getId()) : "NULL")
+                   << ":" << std::to_string(entry->second);
         }
 
         return mapStr.str();
@@ -806,12 +1118,11 @@ public:
             return "";
         }
         std::ostringstream mapStr;
-        auto it = bbsMap->begin();
 
-        for (; it != bbsMap->end(); ++it)
+        for (const auto* entry : sortEntriesById(*bbsMap))
         {
-            mapStr << "[" << it->first->getId() << ":";
-            mapStr << extractNodesIds(it->second);
+            mapStr << "[" << entry->first->getId() << ":";
+            mapStr << extractNodesIds(entry->second);
             mapStr << "]";
         }
 
@@ -845,15 +1156,11 @@ public:
             KeyType key = static_cast<KeyType>(std::stoi(keyStr));
             ValueContainer values;
     
-            if (!valuesStr.empty())
+            DBIdList::Reader reader(valuesStr);
+            s64_t value;
+            while (reader.next(value))
             {
-                std::stringstream ss(valuesStr);
-                std::string token;
-                while (std::getline(ss, token, ','))
-                {
-                    if (!token.empty())
-                        values.insert(values.end(), static_cast<ValueType>(std::stoi(token)));
-                }
+                values.insert(values.end(), static_cast<ValueType>(value));
             }
     
             result[key] = values;
@@ -870,8 +1177,9 @@ public:
             return "";
         }
         std::ostringstream mapStr;
-        for (const auto& pair : *bbsMap)
+        for (const auto* entry : sortEntriesById(*bbsMap))
         {
+            const auto& pair = *entry;
             if (mapStr.tellp() != std::streampos(0))
             {
                 mapStr << ",";
@@ -931,17 +1239,7 @@ public:
 
         for (auto it = map.begin(); it != map.end(); ++it)
         {
-            oss << "[" << it->first << ":";
-            const SVFStmt::SVFStmtSetTy& set = it->second;
-            for (auto setIt = set.begin(); setIt != set.end(); ++setIt)
-            {
-                if (setIt != set.begin())
-                {
-                    oss << ",";
-                }
-                oss << (*setIt)->getEdgeID();
-            }
-            oss << "]";
+            oss << "[" << it->first << ":" << extractEdgesIds(it->second) << "]";
 
             if (std::next(it) != map.end())
             {
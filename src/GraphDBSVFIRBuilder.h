@@ -12,6 +12,9 @@
 #include "SVF-LLVM/CHGBuilder.h"
 #include "GraphDBClient.h"
 #include "DBOptions.h"
+#include "DBWriteStat.h"
+#include <functional>
+#include <thread>
 
 using namespace SVF;
 
@@ -33,6 +36,9 @@ namespace SVF
             DBOUT(DGENERAL, outs() << pasMsg("\t Building SVFIR ...\n"));
             if (SVF::ReadFromDB())
             {
+                // under -db-entry the function bodies are left out here and those
+                // reachable from the entries read by GraphDBClient::loadFunctionsFromDB()
+                GraphDBClient::getInstance().openSnapshot(dbConnection);
                 GraphDBClient::getInstance().readSVFTypesFromDB(dbConnection, "SVFType", pag);
                 GraphDBClient::getInstance().initialSVFPAGNodesFromDB(dbConnection, "PAG", pag);
                 GraphDBClient::getInstance().readBasicBlockGraphFromDB(dbConnection, "BasicBlockGraph");
@@ -42,9 +48,19 @@ namespace SVF
                 pag->icfg = icfg;
                 CallGraph *callGraph = GraphDBClient::getInstance().buildCallGraphFromDB(dbConnection, "CallGraph", pag);
                 pag->callGraph = callGraph;
-                GraphDBClient::getInstance().updatePAGNodesFromDB(dbConnection, "PAG", pag);
+                GraphDBClient::getInstance().updatePAGNodesFromDB(pag);
                 GraphDBClient::getInstance().loadSVFPAGEdgesFromDB(dbConnection, "PAG", pag);
                 GraphDBClient::getInstance().parseSVFStmtsForICFGNodeFromDBResult(pag);
+                if (!SVF::DBEntryFunctions().empty())
+                {
+                    Set<NodeID> funs = GraphDBClient::getInstance().getReachableFunctions(callGraph, SVF::DBEntryFunctions());
+                    GraphDBClient::getInstance().loadFunctionsFromDB(dbConnection, funs, pag);
+                }
+                GraphDBClient::getInstance().closeSnapshot();
+                if (!SVF::DBLazyLoad())
+                {
+                    GraphDBClient::getInstance().releaseDBLoadTables();
+                }
                 return pag;
             }
 
@@ -140,14 +156,18 @@ namespace SVF
 
             pag->setNodeNumAfterPAGBuild(pag->getTotalNodeNum());
 
-            if (SVF::Write2DB())
+            if (SVF::Write2DB() || !SVF::Write2DBOfflineDir().empty())
+            {
+                writeGraphs2DB(chg);
+            }
+            // the graphs written anew have lost the stored procedures loaded before
+            if (SVF::DBProcedures())
             {
-                std::string dbname = "SVFType";
-                GraphDBClient::getInstance().insertSVFTypeNodeSet2db(&pag->getSVFTypes(), &pag->getStInfos(), dbname);
-                GraphDBClient::getInstance().insertPAG2db(pag);
-                GraphDBClient::getInstance().insertICFG2db(pag->icfg);
-                GraphDBClient::getInstance().insertCHG2db(chg);
-                GraphDBClient::getInstance().insertCallGraph2db(pag->callGraph);
+                GraphDBClient::getInstance().loadProcedures2db();
+            }
+            if (!SVF::DBQueryPts().empty() || !SVF::DBQueryReach().empty())
+            {
+                GraphDBClient::getInstance().queryProcedures();
             }
 
             // dump SVFIR
@@ -179,6 +199,57 @@ namespace SVF
 
             return pag;
         }
+
+    private:
+        /// Each graph goes to its own subgraph, so they are written by concurrent
+        /// tasks when the writes do not share a connection (-db-threads > 1 or
+        /// -write2db-offline). The CHG sets fields of ICFG nodes, so it is written
+        /// after the ICFG within the same task.
+        void writeGraphs2DB(CHGraph *chg)
+        {
+            GraphDBClient &client = GraphDBClient::getInstance();
+            DBWriteStat stat;
+            auto timed = [&stat](const std::string &graph, const std::function<void()> &write)
+            {
+                auto start = stat.startGraph(graph);
+                write();
+                stat.endGraph(graph, start);
+            };
+            // decided before any graph is touched, the plan reads the hashes of all of them
+            if (SVF::Write2DBIncremental())
+            {
+                client.planIncrementalWrite(pag, chg);
+            }
+            std::vector<std::function<void()>> tasks = {
+                [&]()
+                {
+                    std::string dbname = "SVFType";
+                    timed(dbname, [&]() { client.insertSVFTypeNodeSet2db(&pag->getSVFTypes(), &pag->getStInfos(), dbname); });
+                },
+                [&]() { timed("PAG", [&]() { client.insertPAG2db(pag); }); },
+                [&]()
+                {
+                    timed("ICFG", [&]() { client.insertICFG2db(pag->icfg); });
+                    timed("CHG", [&]() { client.insertCHG2db(chg); });
+                },
+                [&]() { timed("CallGraph", [&]() { client.insertCallGraph2db(pag->callGraph); }); },
+            };
+
+            if (SVF::DBThreads() > 1 || client.isOfflineMode())
+            {
+                std::vector<std::thread> workers;
+                for (const auto &task : tasks)
+                    workers.emplace_back(task);
+                for (std::thread &worker : workers)
+                    worker.join();
+            }
+            else
+            {
+                for (const auto &task : tasks)
+                    task();
+            }
+            stat.performStat();
+        }
     };
 }
 #endif // GRAPHDBSVFIRBUILDER_H_
@@ -0,0 +1,63 @@
+#ifndef INCLUDE_PROCEDUREUTIL_H_
+#define INCLUDE_PROCEDUREUTIL_H_
+#include "lgraph/lgraph.h"
+#include "tools/json.hpp"
+#include <string>
+#include <vector>
+
+/// What the stored procedures of the ICFG and PAG graphs share. They run
+/// inside the TuGraph server, so they use its plugin API rather than SVF.
+namespace svf_procedure
+{
+
+using json = nlohmann::json;
+
+/// the vid of the vertex whose id property is id, whatever its label; -1 if none
+inline int64_t findVertex(lgraph_api::Transaction& txn, const std::vector<std::string>& labels, int64_t id)
+{
+    for (const std::string& label : labels)
+    {
+        auto it = txn.GetVertexIndexIterator(label, "id", lgraph_api::FieldData::Int32(id),
+                                             lgraph_api::FieldData::Int32(id));
+        if (it.IsValid())
+            return it.GetVid();
+    }
+    return -1;
+}
+
+/// the id property of the vertex vid
+inline int64_t getId(lgraph_api::Transaction& txn, int64_t vid)
+{
+    return txn.GetVertexIterator(vid).GetField("id").integer();
+}
+
+/// the vertex labels which have an id property, the DBVersion stamp left out
+inline std::vector<std::string> getNodeLabels(lgraph_api::Transaction& txn)
+{
+    std::vector<std::string> labels;
+    for (const std::string& label : txn.ListVertexLabels())
+    {
+        if (label != "DBVersion")
+            labels.push_back(label);
+    }
+    return labels;
+}
+
+/// parse request into params, else write the error into response
+inline bool parseRequest(const std::string& request, json& params, std::string& response)
+{
+    try
+    {
+        params = json::parse(request);
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        response = json{{"error", std::string("bad request: ") + e.what()}}.dump();
+        return false;
+    }
+}
+
+} // namespace svf_procedure
+
+#endif
@@ -0,0 +1,44 @@
+/// Stored procedure loaded into every graph written online: add the edges of
+/// one label between vertices given by their vids, which DBBatchWriter knows
+/// for the nodes it wrote, so that no index lookup of the endpoints is needed.
+///   request:  {"label": <edge label>, "fields": [<property names>],
+///              "edges": [[<src vid>, <dst vid>, <property values as strings>...], ...]}
+///   response: {"added": <number of edges>}
+/// The edges are added in one transaction, none of them if any fails.
+
+#include "ProcedureUtil.h"
+
+using namespace svf_procedure;
+
+extern "C" LGAPI bool Process(lgraph_api::GraphDB& db, const std::string& request, std::string& response)
+{
+    json params;
+    if (!parseRequest(request, params, response))
+        return false;
+    std::string label = params.value("label", "");
+    std::vector<std::string> fields = params.value("fields", std::vector<std::string>());
+
+    auto txn = db.CreateWriteTxn();
+    size_t added = 0;
+    try
+    {
+        for (const json& edge : params.at("edges"))
+        {
+            std::vector<std::string> values;
+            for (size_t i = 2; i < edge.size(); ++i)
+                values.push_back(edge[i].get<std::string>());
+            // the values are parsed by the field types of the label's schema
+            txn.AddEdge(edge[0].get<int64_t>(), edge[1].get<int64_t>(), label, fields, values);
+            ++added;
+        }
+        txn.Commit();
+    }
+    catch (const std::exception& e)
+    {
+        txn.Abort();
+        response = json{{"error", std::string(e.what())}}.dump();
+        return false;
+    }
+    response = json{{"added", added}}.dump();
+    return true;
+}
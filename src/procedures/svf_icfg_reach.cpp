@@ -0,0 +1,83 @@
+/// Stored procedure of the ICFG graph: the ICFG nodes reachable from a node
+/// along IntraCFGEdge/CallCFGEdge/RetCFGEdge edges.
+///   request:  {"id": <ICFG node id>, "context_sensitive": <bool, default false>,
+///              "k": <call string length, default 3>}
+///   response: {"reachable": [<ICFG node ids>]}
+/// Context-sensitive, a RetCFGEdge is only followed back to the call site of
+/// the CallCFGEdge the path entered the function with (CFL reachability over
+/// call strings of at most k call sites; once longer, the oldest are dropped
+/// and any return is taken from there, which keeps the result sound).
+
+#include "ProcedureUtil.h"
+#include <deque>
+#include <set>
+
+using namespace svf_procedure;
+
+extern "C" LGAPI bool Process(lgraph_api::GraphDB& db, const std::string& request, std::string& response)
+{
+    json params;
+    if (!parseRequest(request, params, response))
+        return false;
+    int64_t id = params.value("id", -1);
+    bool contextSensitive = params.value("context_sensitive", false);
+    size_t k = params.value("k", static_cast<size_t>(3));
+
+    auto txn = db.CreateReadTxn();
+    int64_t src = findVertex(txn, getNodeLabels(txn), id);
+    if (src < 0)
+    {
+        response = json{{"error", "no ICFG node " + std::to_string(id)}}.dump();
+        return false;
+    }
+
+    // a state is a node with the call string it was reached with
+    typedef std::pair<int64_t, std::vector<int64_t>> State;
+    std::set<State> visited;
+    std::set<int64_t> reachable;
+    std::deque<State> worklist;
+    visited.insert(State(src, {}));
+    worklist.push_back(State(src, {}));
+    while (!worklist.empty())
+    {
+        State state = std::move(worklist.front());
+        worklist.pop_front();
+        reachable.insert(state.first);
+        auto vit = txn.GetVertexIterator(state.first);
+        for (auto eit = vit.GetOutEdgeIterator(); eit.IsValid(); eit.Next())
+        {
+            const std::string& label = eit.GetLabel();
+            State next(eit.GetDst(), state.second);
+            if (contextSensitive && label == "CallCFGEdge")
+            {
+                next.second.push_back(getId(txn, state.first));
+                if (next.second.size() > k)
+                    next.second.erase(next.second.begin());
+            }
+            else if (contextSensitive && label == "RetCFGEdge")
+            {
+                int64_t callSite = txn.GetVertexIterator(next.first).GetField("call_block_node_id").integer();
+                if (!next.second.empty())
+                {
+                    if (next.second.back() != callSite)
+                        continue;
+                    next.second.pop_back();
+                }
+            }
+            else if (label != "IntraCFGEdge" && label != "CallCFGEdge" && label != "RetCFGEdge")
+            {
+                continue;
+            }
+            if (visited.insert(next).second)
+                worklist.push_back(std::move(next));
+        }
+    }
+
+    json ids = json::array();
+    for (int64_t vid : reachable)
+    {
+        ids.push_back(getId(txn, vid));
+    }
+    response = json{{"reachable", ids}}.dump();
+    return true;
+}
@@ -0,0 +1,49 @@
+/// Stored procedure of the PAG graph: the objects a PAG node points to through
+/// AddrStmt/CopyStmt edges alone, i.e. the address-taken objects whose address
+/// is copied into it. Loads, stores, field accesses and calls are not followed,
+/// so it answers the copy-only subset of the Andersen points-to set.
+///   request:  {"id": <PAG node id>}
+///   response: {"pts": [<object node ids>]}
+
+#include "ProcedureUtil.h"
+#include <set>
+
+using namespace svf_procedure;
+
+extern "C" LGAPI bool Process(lgraph_api::GraphDB& db, const std::string& request, std::string& response)
+{
+    json params;
+    if (!parseRequest(request, params, response))
+        return false;
+    int64_t id = params.value("id", -1);
+
+    auto txn = db.CreateReadTxn();
+    int64_t dst = findVertex(txn, getNodeLabels(txn), id);
+    if (dst < 0)
+    {
+        response = json{{"error", "no PAG node " + std::to_string(id)}}.dump();
+        return false;
+    }
+
+    // backwards along the copies, the objects being the sources of the AddrStmts met
+    std::set<int64_t> visited = {dst};
+    std::vector<int64_t> worklist = {dst};
+    std::set<int64_t> objs;
+    while (!worklist.empty())
+    {
+        int64_t vid = worklist.back();
+        worklist.pop_back();
+        auto vit = txn.GetVertexIterator(vid);
+        for (auto eit = vit.GetInEdgeIterator(); eit.IsValid(); eit.Next())
+        {
+            const std::string& label = eit.GetLabel();
+            if (label == "AddrStmt")
+                objs.insert(getId(txn, eit.GetSrc()));
+            else if (label == "CopyStmt" && visited.insert(eit.GetSrc()).second)
+                worklist.push_back(eit.GetSrc());
+        }
+    }
+
+    response = json{{"pts", objs}}.dump();
+    return true;
+}
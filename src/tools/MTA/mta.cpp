@@ -22,10 +22,11 @@
 
 #include "SVF-LLVM/LLVMUtil.h"
 #include "GraphDBSVFIRBuilder.h"
-#include "MTA/MTA.h"
+#include "DBMTA.h"
 #include "Util/CommandLine.h"
 #include "Util/Options.h"
 #include "DBOptions.h"
+#include "DBAndersen.h"
 
 using namespace llvm;
 using namespace std;
@@ -56,7 +57,17 @@ int main(int argc, char ** argv)
     pag = builder.build();
 
 
-    MTA mta;
+    // the Andersen analysis of the checks reads the points-to sets taken from DB, or
+    // solved and stored here, from a file of this run
+    if (SVF::ReadPTAFromDB() || SVF::PTAWarmStart() || SVF::Write2DBIndCalls() ||
+        SVF::Write2DB() || !SVF::Write2DBOfflineDir().empty())
+    {
+        DBAndersenWaveDiff::shareResult(pag);
+    }
+
+    // under -write2db the threads, MHP pairs and locks found are stored in the ThreadAnalysis graph,
+    // under -read-mta-from-db the races are checked with those stored
+    DBMTA mta;
     mta.runOnModule(pag);
 
     LLVMModuleSet::releaseLLVMModuleSet();
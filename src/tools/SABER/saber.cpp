@@ -28,12 +28,11 @@
 
 #include "SVF-LLVM/LLVMUtil.h"
 #include "GraphDBSVFIRBuilder.h"
-#include "SABER/LeakChecker.h"
-#include "SABER/FileChecker.h"
-#include "SABER/DoubleFreeChecker.h"
+#include "DBSaber.h"
 #include "Util/CommandLine.h"
 #include "Util/Options.h"
 #include "DBOptions.h"
+#include "DBAndersen.h"
 #include "Util/Z3Expr.h"
 
 
@@ -67,18 +66,57 @@ int main(int argc, char ** argv)
     pag = builder.build();
 
 
+    // the Andersen analysis of the checks reads the points-to sets taken from DB, or
+    // solved and stored here, from a file of this run
+    if (SVF::ReadPTAFromDB() || SVF::PTAWarmStart() || SVF::Write2DBIndCalls() ||
+        SVF::Write2DB() || !SVF::Write2DBOfflineDir().empty())
+    {
+        DBAndersenWaveDiff::shareResult(pag);
+    }
+
+    // the SVFG of the checks reads its memory regions and indirect edges from a
+    // file of this run filled from DB instead of connecting them, the file of
+    // -read-svfg if given. The SVFG written to DB is SVF's file of -write-svfg,
+    // one of this run if not given
+    GraphDBClient& client = GraphDBClient::getInstance();
+    if (SVF::ReadSVFGFromDB() && Options::ReadSVFG().empty())
+    {
+        std::string file = createTempFile("svf-svfg");
+        if (!file.empty() && client.readSVFGFileFromDB(client.getConnection(), "SVFG", file))
+            setSVFOption("read-svfg", file);
+        else
+            SVFUtil::outs() << "Warning: [saber] no SVFG of this PAG in DB, building it\n";
+    }
+    if ((SVF::Write2DB() || !SVF::Write2DBOfflineDir().empty()) && Options::WriteSVFG().empty())
+    {
+        setSVFOption("write-svfg", createTempFile("svf-svfg"));
+    }
+
     std::unique_ptr<LeakChecker> saber;
+    std::vector<DBBugReport> reports;
 
     if(Options::MemoryLeakCheck())
-        saber = std::make_unique<LeakChecker>();
+        saber = std::make_unique<DBSaberChecker<LeakChecker>>(reports);
     else if(Options::FileCheck())
-        saber = std::make_unique<FileChecker>();
+        saber = std::make_unique<DBSaberChecker<FileChecker>>(reports);
     else if(Options::DFreeCheck())
-        saber = std::make_unique<DoubleFreeChecker>();
+        saber = std::make_unique<DBSaberChecker<DoubleFreeChecker>>(reports);
     else
-        saber = std::make_unique<LeakChecker>();  // if no checker is specified, we use leak checker as the default one.
+        saber = std::make_unique<DBSaberChecker<LeakChecker>>(reports);  // if no checker is specified, we use leak checker as the default one.
 
     saber->runOnModule(pag);
+
+    if (SVF::Write2DB() || !SVF::Write2DBOfflineDir().empty())
+    {
+        client.insertSVFG2db(Options::WriteSVFG());
+        // the bugs, to be queried and compared by fingerprint without running the checker
+        DBBugReportResult previous;
+        if (client.readBugReportsFromDB(client.getConnection(), "BugReport", -1, previous))
+        {
+            DBBugReporter::printChanges(previous, reports);
+        }
+        client.insertBugReports2db(reports);
+    }
     LLVMModuleSet::releaseLLVMModuleSet();
 
 
@@ -32,6 +32,7 @@
 #include "Util/Options.h"
 #include "DBOptions.h"
 #include "GraphDBSVFIRBuilder.h"
+#include "DBAndersen.h"
 
 
 using namespace llvm;
@@ -67,6 +68,14 @@ int main(int argc, char** argv)
 
     }
 
+    // the Andersen analyses of WPAPass read the points-to sets taken from DB, or
+    // solved and stored here, from a file of this run, so that they are solved once
+    if (SVF::ReadPTAFromDB() || SVF::PTAWarmStart() || SVF::Write2DBIndCalls() ||
+        SVF::Write2DB() || !SVF::Write2DBOfflineDir().empty())
+    {
+        DBAndersenWaveDiff::shareResult(pag);
+    }
+
     WPAPass wpa;
     wpa.runOnModule(pag);
 
@@ -0,0 +1,100 @@
+#include "DBBatchWriter.h"
+#include "TestUtil.h"
+
+using namespace SVF;
+
+static bool split(const std::string& body, std::vector<std::string>& keys, std::vector<std::string>& values)
+{
+    keys.clear();
+    values.clear();
+    return DBBatchWriter::splitCypherMap(body, keys, &values);
+}
+
+static void testSplitCypherMap()
+{
+    std::vector<std::string> keys;
+    std::vector<std::string> values;
+    CHECK(split("id:1, kind:2, name:'a'", keys, values));
+    CHECK(keys == std::vector<std::string>({"id", "kind", "name"}));
+    CHECK(values == std::vector<std::string>({"1", "2", "'a'"}));
+
+    // commas, colons and braces within quotes, lists and maps stay in the value
+    CHECK(split("s:'a,b:{c}', l:[1, 2], m:{x:1, y:[3]}, t:'it\\'s, ok'", keys, values));
+    CHECK(keys == std::vector<std::string>({"s", "l", "m", "t"}));
+    CHECK(values == std::vector<std::string>({"'a,b:{c}'", "[1, 2]", "{x:1, y:[3]}", "'it\\'s, ok'"}));
+
+    // blanks and empty items around the entries are skipped
+    CHECK(split("  a : 1 ,, b:-2  ,", keys, values));
+    CHECK(keys == std::vector<std::string>({"a", "b"}));
+    CHECK(values == std::vector<std::string>({"1", "-2"}));
+    CHECK(split("", keys, values));
+    CHECK(keys.empty());
+
+    // the values are optional
+    keys.clear();
+    CHECK(DBBatchWriter::splitCypherMap("id:1, pts:'~2'", keys));
+    CHECK(keys == std::vector<std::string>({"id", "pts"}));
+}
+
+static void testSplitInvalid()
+{
+    std::vector<std::string> keys;
+    std::vector<std::string> values;
+    CHECK(!split("id", keys, values));
+    CHECK(!split(":1", keys, values));
+    CHECK(!split("a-b:1", keys, values));
+    CHECK(!split("n.id:1", keys, values));
+    CHECK(!split("s:'open", keys, values));
+    CHECK(!split("l:[1, 2", keys, values));
+    CHECK(!split("m:{x:1", keys, values));
+}
+
+static void testNodeInsertStmt()
+{
+    DBInsertRow row;
+    CHECK(DBBatchWriter::parseNodeInsertStmt("CREATE (n:ValVar {id:1, kind:2, name:'x{}'})", row));
+    CHECK(row.label == "ValVar");
+    CHECK(row.props == "id:1, kind:2, name:'x{}'");
+    CHECK(row.keys == std::vector<std::string>({"id", "kind", "name"}));
+    CHECK(row.stmt == "CREATE (n:ValVar {id:1, kind:2, name:'x{}'})");
+
+    CHECK(!DBBatchWriter::parseNodeInsertStmt("MERGE (n:ValVar {id:1})", row));
+    CHECK(!DBBatchWriter::parseNodeInsertStmt("CREATE (n:ValVar)", row));
+    CHECK(!DBBatchWriter::parseNodeInsertStmt("CREATE (n: {id:1})", row));
+    CHECK(!DBBatchWriter::parseNodeInsertStmt("CREATE (n:ValVar {id:1)", row));
+}
+
+static void testEdgeInsertStmt()
+{
+    const std::string stmt = "MATCH (n:ValVar{id:1}), (m:ObjVar{id:2}) WHERE n.id = 1 AND m.id = 2"
+                             " CREATE (n)-[r:AddrStmt{edge_id:3, kind:0, bb_id:'', call_edge_label_counter:{a:1}}]->(m)";
+    DBInsertRow row;
+    CHECK(DBBatchWriter::parseEdgeInsertStmt(stmt, row));
+    CHECK(row.label == "AddrStmt");
+    CHECK(row.srcLabel == "ValVar" && row.srcField == "id" && row.srcValue == "1");
+    CHECK(row.dstLabel == "ObjVar" && row.dstField == "id" && row.dstValue == "2");
+    CHECK(row.props == "edge_id:3, kind:0, bb_id:'', call_edge_label_counter:{a:1}");
+    CHECK(row.keys == std::vector<std::string>({"edge_id", "kind", "bb_id", "call_edge_label_counter"}));
+    CHECK(row.stmt == stmt);
+
+    // the vertices are matched on one field, of any name
+    CHECK(DBBatchWriter::parseEdgeInsertStmt(
+        "MATCH (n:CallGraphNode{fun_obj_var_id:'7'}), (m:CallGraphNode{fun_obj_var_id:'8'}) CREATE (n)-[r:CallGraphEdge{csid:1}]->(m)",
+        row));
+    CHECK(row.srcField == "fun_obj_var_id" && row.srcValue == "'7'");
+    CHECK(row.dstValue == "'8'");
+
+    CHECK(!DBBatchWriter::parseEdgeInsertStmt("CREATE (n:ValVar {id:1})", row));
+    CHECK(!DBBatchWriter::parseEdgeInsertStmt("MATCH (n:ValVar{id:1, kind:2}), (m:ObjVar{id:2}) CREATE (n)-[r:AddrStmt{edge_id:3}]->(m)", row));
+    CHECK(!DBBatchWriter::parseEdgeInsertStmt("MATCH (n:ValVar{id:1}) CREATE (n)-[r:AddrStmt{edge_id:3}]->(n)", row));
+    CHECK(!DBBatchWriter::parseEdgeInsertStmt("MATCH (n:ValVar{id:1}), (m:ObjVar{id:2}) CREATE (n)-[r:AddrStmt]->(m)", row));
+}
+
+int main()
+{
+    testSplitCypherMap();
+    testSplitInvalid();
+    testNodeInsertStmt();
+    testEdgeInsertStmt();
+    return testResult("DBBatchWriterTest");
+}
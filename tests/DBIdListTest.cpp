@@ -0,0 +1,112 @@
+#include "DBIdList.h"
+#include "TestUtil.h"
+#include <limits>
+
+using namespace SVF;
+
+static std::string encode(const std::vector<s64_t>& ids)
+{
+    return DBIdList::encode(ids.begin(), ids.end(), [](s64_t id) { return id; });
+}
+
+static std::vector<s64_t> decode(const std::string& str)
+{
+    std::vector<s64_t> ids;
+    DBIdList::Reader reader(str);
+    s64_t id;
+    while (reader.next(id))
+    {
+        ids.push_back(id);
+    }
+    return ids;
+}
+
+static bool roundTrips(const std::vector<s64_t>& ids)
+{
+    std::string encoded = encode(ids);
+    // nothing of the encoding needs escaping or splits the maps it is kept in
+    bool plain = encoded.find_first_of("'\"\\,:[]{} ") == std::string::npos;
+    return plain && decode(encoded) == ids;
+}
+
+static void testRoundTrips()
+{
+    const s64_t min = std::numeric_limits<s64_t>::min();
+    const s64_t max = std::numeric_limits<s64_t>::max();
+    CHECK(roundTrips({0}));
+    CHECK(roundTrips({1, 2, 3, 5, 8, 13}));
+    CHECK(roundTrips({100, 99, 98, 1000, 0}));
+    CHECK(roundTrips({-1}));
+    CHECK(roundTrips({-1, -2, 5, -100000, 7}));
+    // the borders of one and two digits: zigzag 31/32 and 1023/1024
+    CHECK(roundTrips({15, -16, 16, -17, 0, 511, -512, 512, -513}));
+    CHECK(roundTrips({std::numeric_limits<NodeID>::max(), 0, std::numeric_limits<NodeID>::max()}));
+    // differences which overflow s64_t wrap around
+    CHECK(roundTrips({max, min, max, 0, min, -1, max}));
+    CHECK(roundTrips({min}));
+    CHECK(roundTrips({max}));
+}
+
+static void testDigits()
+{
+    // zigzag: 0 -> 0, -1 -> 1, 1 -> 2, 15 -> 30, -16 -> 31, 16 -> 32
+    CHECK(encode({0}) == "~0");
+    CHECK(encode({-1}) == "~1");
+    CHECK(encode({1}) == "~2");
+    CHECK(encode({-16}) == "~V");
+    CHECK(encode({16}).size() == 3);
+    // the differences are encoded, not the ids
+    CHECK(encode({1000, 1001, 1002}).size() == encode({1000}).size() + 2);
+    // 64 bit values take at most 13 digits
+    CHECK(encode({std::numeric_limits<s64_t>::min()}).size() == 1 + 13);
+}
+
+static void testEmpty()
+{
+    CHECK(encode({}) == "");
+    CHECK(decode("").empty());
+    CHECK(decode("~").empty());
+}
+
+static void testCommaLists()
+{
+    // lists of graphs written before the encoding
+    CHECK(decode("1,2,3") == std::vector<s64_t>({1, 2, 3}));
+    CHECK(decode("7") == std::vector<s64_t>({7}));
+    CHECK(decode("-1, 4 ,-20,") == std::vector<s64_t>({-1, 4, -20}));
+    CHECK(decode(",,5") == std::vector<s64_t>({5}));
+    CHECK(decode("4294967295") == std::vector<s64_t>({4294967295LL}));
+}
+
+static void testInvalid()
+{
+    // the ids before the bad character are kept, reading stops there
+    CHECK(decode("~24*2") == std::vector<s64_t>({1, 3}));
+    CHECK(decode("1,x,3") == std::vector<s64_t>({1}));
+    CHECK(decode("1,-") == std::vector<s64_t>({1}));
+    // a digit announcing more digits at the end of the list
+    CHECK(decode("~2g") == std::vector<s64_t>({1}));
+}
+
+static void testSubrange()
+{
+    // the reader walks [begin, end) of a larger string in place
+    std::string str = "[" + encode({3, 1, 4}) + "]";
+    DBIdList::Reader reader(str.data() + 1, str.data() + str.size() - 1);
+    std::vector<s64_t> ids;
+    s64_t id;
+    while (reader.next(id))
+        ids.push_back(id);
+    CHECK(ids == std::vector<s64_t>({3, 1, 4}));
+}
+
+int main()
+{
+    testRoundTrips();
+    testDigits();
+    testEmpty();
+    testCommaLists();
+    testInvalid();
+    testSubrange();
+    return testResult("DBIdListTest");
+}
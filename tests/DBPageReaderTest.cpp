@@ -0,0 +1,60 @@
+#include "DBPageReader.h"
+#include "TestUtil.h"
+
+using namespace SVF;
+
+/// the page size is that of -db-page-size, 1000 by default
+static void testRowPages()
+{
+    CHECK(DBPageReader::getKeysetPageStmt("node", {"node.id"}, {}) ==
+          " RETURN node, node.id AS page_key_0 ORDER BY node.id LIMIT 1000");
+    CHECK(DBPageReader::getKeysetPageStmt("node", {"node.id"}, {"42"}) ==
+          " WHERE (node.id > 42) RETURN node, node.id AS page_key_0 ORDER BY node.id LIMIT 1000");
+    // the keys are compared in order, the later ones breaking the ties of the former
+    CHECK(DBPageReader::getKeysetPageStmt("node", {"a", "b"}, {"1", "2"}) ==
+          " WHERE (a > 1) OR (a = 1 AND b > 2) RETURN node, a AS page_key_0, b AS page_key_1 ORDER BY a, b LIMIT 1000");
+    CHECK(DBPageReader::getKeysetPageStmt("edge", {"a", "b", "c"}, {"1", "2", "3"}) ==
+          " WHERE (a > 1) OR (a = 1 AND b > 2) OR (a = 1 AND b = 2 AND c > 3)"
+          " RETURN edge, a AS page_key_0, b AS page_key_1, c AS page_key_2 ORDER BY a, b, c LIMIT 1000");
+}
+
+/// pages cut on the vertices of pageVar before expanding them
+static void testVertexPages()
+{
+    const std::string expand = "OPTIONAL MATCH (n)-[edge:CallCFGEdge]->(m)";
+    CHECK(DBPageReader::getKeysetPageStmt("edge", {"n.id"}, {}, "n", expand) ==
+          " WITH n ORDER BY n.id LIMIT 1000 OPTIONAL MATCH (n)-[edge:CallCFGEdge]->(m)"
+          " RETURN edge, n.id AS page_key_0 ORDER BY n.id");
+    CHECK(DBPageReader::getKeysetPageStmt("edge", {"n.id"}, {"42"}, "n", expand) ==
+          " WHERE (n.id > 42) WITH n ORDER BY n.id LIMIT 1000 OPTIONAL MATCH (n)-[edge:CallCFGEdge]->(m)"
+          " RETURN edge, n.id AS page_key_0 ORDER BY n.id");
+}
+
+static void testNextPageKeys()
+{
+    std::vector<std::string> lastKeys;
+    DBResult page(R"([{"node":1, "page_key_0":3, "page_key_1":4}, {"node":2, "page_key_0":5, "page_key_1":-6}])");
+    // a short page is the last one, its keys are taken all the same
+    CHECK(!DBPageReader::getNextPageKeys(&page, 2, lastKeys));
+    CHECK(lastKeys == std::vector<std::string>({"5", "-6"}));
+
+    std::string rows = "[";
+    for (int i = 0; i < 1000; ++i)
+        rows += (i > 0 ? ", {\"page_key_0\":" : "{\"page_key_0\":") + std::to_string(i * 2) + "}";
+    DBResult fullPage(rows + "]");
+    CHECK(DBPageReader::getNextPageKeys(&fullPage, 1, lastKeys));
+    CHECK(lastKeys == std::vector<std::string>({"1998"}));
+
+    DBResult empty("[]");
+    CHECK(!DBPageReader::getNextPageKeys(&empty, 1, lastKeys));
+    DBResult missing(R"([{"node":1}])");
+    CHECK(!DBPageReader::getNextPageKeys(&missing, 1, lastKeys));
+}
+
+int main()
+{
+    testRowPages();
+    testVertexPages();
+    testNextPageKeys();
+    return testResult("DBPageReaderTest");
+}
@@ -0,0 +1,147 @@
+#include "DBResult.h"
+#include "TestUtil.h"
+#include <climits>
+#include <cstring>
+
+using namespace SVF;
+
+static bool isString(const DBValue* value, const char* expected)
+{
+    return nullptr != value && value->isString() && std::strcmp(value->valuestring, expected) == 0;
+}
+
+/// rows of objects with the same members share one layout, found through DB_FIELD
+static void testRows()
+{
+    DBResult result(R"([{"node":{"id":1,"name":"a"}}, {"node":{"id":2,"name":"b"}}])");
+    CHECK(result.isValid());
+    CHECK(result.size() == 2);
+    s64_t sum = 0;
+    std::string names;
+    for (const DBValue* row : result)
+    {
+        const DBValue* node = row->get(DB_FIELD("node"));
+        CHECK(nullptr != node && node->isObject());
+        sum += node->getInt(DB_FIELD("id"));
+        names += node->getString(DB_FIELD("name"));
+    }
+    CHECK(sum == 3);
+    CHECK(names == "ab");
+    CHECK(result.at(0)->get(DB_FIELD("node")) != nullptr);
+    CHECK(result.at(2) == nullptr);
+
+    // absent members read as 0, false and ""
+    const DBValue* node = result.at(0)->get("node");
+    CHECK(nullptr == node->get("missing"));
+    CHECK(node->getInt(DB_FIELD("missing")) == 0);
+    CHECK(node->getDouble(DB_FIELD("missing")) == 0);
+    CHECK(!node->getBool(DB_FIELD("missing")));
+    CHECK(std::strcmp(node->getString(DB_FIELD("missing")), "") == 0);
+    // a number is not a string
+    CHECK(std::strcmp(node->getString(DB_FIELD("id")), "") == 0);
+}
+
+/// members in another order make another layout, the fields follow it
+static void testLayouts()
+{
+    DBResult result(R"([{"a":1,"b":2}, {"b":3,"a":4}, {"a":5}])");
+    CHECK(result.isValid());
+    int a = 0;
+    int b = 0;
+    for (const DBValue* row : result)
+    {
+        a += row->getInt(DB_FIELD("a"));
+        b += row->getInt(DB_FIELD("b"));
+    }
+    CHECK(a == 10);
+    CHECK(b == 5);
+}
+
+static void testEscapes()
+{
+    DBResult result(R"(["q\"b\\s\/", "\b\f\n\r\t", "\u0041\u00e9\u20ac", "\ud83d\ude00", "", "it's"])");
+    CHECK(result.isValid());
+    CHECK(result.size() == 6);
+    CHECK(isString(result.at(0), "q\"b\\s/"));
+    CHECK(isString(result.at(1), "\b\f\n\r\t"));
+    CHECK(isString(result.at(2), "A\xC3\xA9\xE2\x82\xAC"));
+    CHECK(isString(result.at(3), "\xF0\x9F\x98\x80"));
+    CHECK(isString(result.at(4), ""));
+    CHECK(isString(result.at(5), "it's"));
+
+    // escaped member names are looked up decoded
+    DBResult keys(R"([{"a\"b":1}])");
+    CHECK(keys.isValid());
+    CHECK(keys.at(0)->getInt(DB_FIELD("a\"b")) == 1);
+}
+
+static void testNested()
+{
+    DBResult result(R"([[], [[1, [2, [3]]], {}], {"l":[{"x":[true, false, null]}]}])");
+    CHECK(result.isValid());
+    CHECK(result.size() == 3);
+    CHECK(result.at(0)->isArray() && result.at(0)->size() == 0);
+
+    const DBValue* second = result.at(1);
+    CHECK(second->isArray() && second->size() == 2);
+    const DBValue* inner = second->at(0);
+    CHECK(inner->size() == 2 && inner->at(0)->valueint == 1);
+    CHECK(inner->at(1)->at(0)->valueint == 2);
+    CHECK(inner->at(1)->at(1)->at(0)->valueint == 3);
+    CHECK(second->at(1)->isObject() && second->at(1)->size() == 0);
+
+    const DBValue* list = result.at(2)->get("l");
+    CHECK(nullptr != list && list->isArray() && list->size() == 1);
+    const DBValue* x = list->at(0)->get("x");
+    CHECK(nullptr != x && x->size() == 3);
+    CHECK(x->at(0)->isTrue() && x->at(0)->valueint == 1);
+    CHECK(x->at(1)->type == DBValue::False);
+    CHECK(x->at(2)->type == DBValue::Null);
+}
+
+static void testNumbers()
+{
+    DBResult result("[0, -7, 2.5, 1e3, -1.5E-2, 9007199254740993, 3000000000, -3000000000]");
+    CHECK(result.isValid());
+    CHECK(result.at(0)->isNumber() && result.at(0)->valueint == 0);
+    CHECK(result.at(1)->valueint == -7);
+    CHECK(result.at(2)->valuedouble == 2.5 && result.at(2)->valueint == 2);
+    CHECK(result.at(3)->valueint == 1000);
+    CHECK(result.at(4)->valuedouble == -0.015);
+    // numbers are doubles, beyond 2^53 they are rounded
+    CHECK(result.at(5)->valuedouble == 9007199254740992.0);
+    // valueint saturates as cJSON does
+    CHECK(result.at(6)->valueint == INT_MAX);
+    CHECK(result.at(7)->valueint == INT_MIN);
+}
+
+static void testInvalid()
+{
+    const char* invalid[] = {"", "  ", "{}", "1", "[", "[1,", "[1 2]", "[1]x", "[\"abc]", "[\"\\x\"]",
+                             "[\"\\u12\"]", "[tru]", "[{\"a\" 1}]", "[{1:2}]", "[-]", "[+1]"};
+    for (const char* json : invalid)
+    {
+        DBResult result{std::string(json)};
+        if (result.isValid())
+            std::cerr << "accepted invalid result: " << json << "\n";
+        CHECK(!result.isValid());
+        CHECK(result.size() == 0);
+        CHECK(result.begin() == result.end());
+        CHECK(result.at(0) == nullptr);
+    }
+
+    DBResult empty(" [ ] \n");
+    CHECK(empty.isValid());
+    CHECK(empty.size() == 0);
+}
+
+int main()
+{
+    testRows();
+    testLayouts();
+    testEscapes();
+    testNested();
+    testNumbers();
+    testInvalid();
+    return testResult("DBResultTest");
+}
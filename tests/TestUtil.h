@@ -0,0 +1,30 @@
+#ifndef INCLUDE_TESTUTIL_H_
+#define INCLUDE_TESTUTIL_H_
+#include <iostream>
+
+/// The checks of the unit tests: a failed CHECK is reported and counted and
+/// the test goes on, testResult() being the exit code of its main
+static int failures = 0;
+
+#define CHECK(cond)                                                                      \
+    do                                                                                   \
+    {                                                                                    \
+        if (!(cond))                                                                     \
+        {                                                                                \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK(" #cond ") failed\n";   \
+            ++failures;                                                                  \
+        }                                                                                \
+    } while (0)
+
+static inline int testResult(const char* test)
+{
+    if (failures > 0)
+    {
+        std::cerr << failures << " check(s) failed\n";
+        return 1;
+    }
+    std::cout << test << " passed\n";
+    return 0;
+}
+
+#endif // INCLUDE_TESTUTIL_H_